@@ -2,19 +2,32 @@
 #define AUTO_ROUTE_GENERATOR_H
 
 #include "GraphManager.h"
+#include "KdTree.h"
+#include "CoordinateStore.h"
+#include "SpatialGrid.h"
+#include "DelaunayTriangulation.h"
+#include "ThreadPool.h"
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdint>
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <iterator>
+#include <numeric>
 
 using namespace std;
 
 class AutoRouteGenerator {
 private:
     GraphManager& graph;
+    size_t neighborCount;
+    size_t threadCount;  // 0 = sesuai jumlah core
     
 public:
-    explicit AutoRouteGenerator(GraphManager& graph) : graph(graph) {}
+    explicit AutoRouteGenerator(GraphManager& graph, size_t threadCount = 0)
+        : graph(graph), neighborCount(3), threadCount(threadCount), delaunayPruning(DelaunayPruning::NONE) {}
     virtual ~AutoRouteGenerator() = default;
     
     enum class TransportMode {
@@ -24,8 +37,18 @@ public:
     };
     
     enum class ConnectionMethod {
-        NEAREST_NEIGHBORS,  // 3 kota terdekat
-        RADIUS_BASED       // Dalam radius tertentu
+        NEAREST_NEIGHBORS,  // k kota terdekat (setNeighborCount, default 3)
+        RADIUS_BASED,      // Dalam radius tertentu
+        DELAUNAY           // Triangulasi Delaunay (setDelaunayPruning)
+    };
+    
+    // Pemangkasan edge triangulasi pada DELAUNAY. Ketiganya tetap terhubung
+    // (memuat minimum spanning tree): Delaunay rata-rata < 6 koneksi per
+    // kota, Gabriel lebih jarang, relative neighbourhood paling jarang.
+    enum class DelaunayPruning {
+        NONE,                  // semua edge triangulasi
+        GABRIEL,               // tidak ada kota lain di dalam lingkaran berdiameter edge
+        RELATIVE_NEIGHBORHOOD  // tidak ada kota lain yang lebih dekat ke kedua ujung edge
     };
     
     void generateRoutes(TransportMode mode, ConnectionMethod method, double radius = 0) {
@@ -50,6 +73,10 @@ public:
             auto result = generateNearestNeighborRoutes(timeMultiplier, costMultiplier);
             routesCreated = result.first;
             routesSkipped = result.second;
+        } else if (method == ConnectionMethod::DELAUNAY) {
+            auto result = generateDelaunayRoutes(timeMultiplier, costMultiplier);
+            routesCreated = result.first;
+            routesSkipped = result.second;
         } else {
             auto result = generateRadiusBasedRoutes(timeMultiplier, costMultiplier, radius);
             routesCreated = result.first;
@@ -59,6 +86,17 @@ public:
         displayGenerationSummary(routesCreated, routesSkipped, locations.size());
     }
     
+    // Jumlah kota terdekat yang dihubungkan per kota pada NEAREST_NEIGHBORS
+    void setNeighborCount(size_t count) { neighborCount = max<size_t>(1, count); }
+    size_t getNeighborCount() const { return neighborCount; }
+    
+    void setDelaunayPruning(DelaunayPruning pruning) { delaunayPruning = pruning; }
+    DelaunayPruning getDelaunayPruning() const { return delaunayPruning; }
+    
+    // Jumlah thread untuk mencari kandidat rute (0 = sesuai jumlah core)
+    void setThreadCount(size_t count) { threadCount = count; }
+    size_t getThreadCount() const { return threadCount; }
+    
     void ensureBidirectionalGraph() {
         cout << "\n🔄 MENGUBAH GRAF MENJADI BIDIRECTIONAL" << endl;
         
@@ -88,6 +126,8 @@ public:
     }
     
 private:
+    DelaunayPruning delaunayPruning;
+    
     pair<double, double> getMultipliers(TransportMode mode) const {
         switch(mode) {
             case TransportMode::FAST:
@@ -104,82 +144,400 @@ private:
         }
     }
     
-    pair<int, int> generateNearestNeighborRoutes(double timeMultiplier, double costMultiplier) {
+    typedef pair<const string, Location> LocationEntry;
+    
+    static uint64_t edgeKey(uint32_t sourceId, uint32_t destId) {
+        return (static_cast<uint64_t>(sourceId) << 32) | destId;
+    }
+    
+    size_t workerCount() const {
+        return threadCount == 0 ? ThreadPool::defaultThreadCount() : threadCount;
+    }
+    
+    // Membagi [0, count) menjadi blockCount blok; fn(block, first, last)
+    // dijalankan di pool dan fungsi ini menunggu semuanya selesai
+    template <typename BlockFn>
+    static void forEachBlock(ThreadPool& pool, size_t count, size_t blockCount, BlockFn fn) {
+        for (size_t block = 0; block < blockCount; ++block) {
+            size_t first = count * block / blockCount;
+            size_t last = count * (block + 1) / blockCount;
+            pool.submit([&fn, block, first, last]() { fn(block, first, last); });
+        }
+        pool.wait();
+    }
+    
+    // Mengurutkan setiap buffer secara paralel, lalu menggabungkannya
+    // berpasangan (setiap putaran juga paralel) menjadi satu array terurut
+    // tanpa duplikat
+    template <typename T, typename Less>
+    static vector<T> sortAndMerge(vector<vector<T>>& buffers, ThreadPool& pool, Less less) {
+        auto same = [&less](const T& a, const T& b) { return !less(a, b) && !less(b, a); };
+        forEachBlock(pool, buffers.size(), buffers.size(), [&](size_t i, size_t, size_t) {
+            sort(buffers[i].begin(), buffers[i].end(), less);
+            buffers[i].erase(unique(buffers[i].begin(), buffers[i].end(), same), buffers[i].end());
+        });
+        
+        while (buffers.size() > 1) {
+            vector<vector<T>> merged((buffers.size() + 1) / 2);
+            forEachBlock(pool, merged.size(), merged.size(), [&](size_t i, size_t, size_t) {
+                if (2 * i + 1 == buffers.size()) {
+                    merged[i].swap(buffers[2 * i]);
+                    return;
+                }
+                const vector<T>& left = buffers[2 * i];
+                const vector<T>& right = buffers[2 * i + 1];
+                merged[i].reserve(left.size() + right.size());
+                set_union(left.begin(), left.end(), right.begin(), right.end(), back_inserter(merged[i]), less);
+            });
+            buffers.swap(merged);
+        }
+        
+        vector<T> result;
+        if (!buffers.empty()) result.swap(buffers[0]);
+        return result;
+    }
+    
+    static vector<uint64_t> sortAndMerge(vector<vector<uint64_t>>& buffers, ThreadPool& pool) {
+        return sortAndMerge(buffers, pool, less<uint64_t>());
+    }
+    
+    // Mengisi sorted dengan lokasi terurut nama (indeks = ID), coordinates
+    // dengan koordinatnya dalam bentuk kolom, dan edges dengan semua rute
+    // yang sudah ada, sehingga cek duplikat cukup satu lookup hash
+    // alih-alih memindai daftar rute asal. Pengurutan dan pembacaan rute
+    // lama dikerjakan paralel per blok.
+    void indexLocations(vector<const LocationEntry*>& sorted, CoordinateStore& coordinates,
+                        unordered_set<uint64_t>& edges, ThreadPool& pool, size_t blockCount) const {
         const auto& locations = graph.getLocations();
-        int routesCreated = 0;
-        int routesSkipped = 0;
+        auto byName = [](const LocationEntry* a, const LocationEntry* b) { return a->first < b->first; };
         
-        cout << "\n🌐 Menggunakan metode koneksi berdasarkan jarak terdekat (max 3 koneksi per kota)" << endl;
+        vector<vector<const LocationEntry*>> blocks(blockCount);
+        size_t index = 0;
+        for (const LocationEntry& entry : locations) {
+            blocks[index++ * blockCount / locations.size()].push_back(&entry);
+        }
+        sorted = sortAndMerge(blocks, pool, byName);
         
-        for (const auto& source : locations) {
-            vector<pair<double, string>> distances;
-            
-            for (const auto& dest : locations) {
-                if (source.first != dest.first) {
-                    double distance = source.second.distanceTo(dest.second);
-                    distances.push_back({distance, dest.first});
+        coordinates = CoordinateStore(sorted.size());
+        for (uint32_t id = 0; id < sorted.size(); ++id) {
+            coordinates.set(id, sorted[id]->second.getX(), sorted[id]->second.getY());
+        }
+        
+        // Tujuan rute lama dicari dengan binary search pada nama terurut
+        vector<vector<uint64_t>> existing(blockCount);
+        forEachBlock(pool, sorted.size(), blockCount, [&](size_t block, size_t first, size_t last) {
+            for (size_t id = first; id < last; ++id) {
+                for (const Route& route : graph.getRoutesFrom(sorted[id]->first)) {
+                    string destName = route.getDestination();
+                    auto dest = lower_bound(sorted.begin(), sorted.end(), destName,
+                        [](const LocationEntry* entry, const string& name) { return entry->first < name; });
+                    if (dest != sorted.end() && (*dest)->first == destName) {
+                        existing[block].push_back(edgeKey(static_cast<uint32_t>(id),
+                                                          static_cast<uint32_t>(dest - sorted.begin())));
+                    }
                 }
             }
+        });
+        
+        edges.clear();
+        size_t edgeCount = 0;
+        for (const vector<uint64_t>& keys : existing) edgeCount += keys.size();
+        edges.reserve(edgeCount);
+        for (const vector<uint64_t>& keys : existing) edges.insert(keys.begin(), keys.end());
+    }
+    
+    // Kandidat dicari paralel: item [0, itemCount) (kota asal, edge
+    // triangulasi, dst.) dibagi menjadi beberapa blok per thread, dan setiap
+    // blok menulis pasangan (asal, tujuan) ke buffer-nya sendiri lewat
+    // fillBlock(first, last, buffer). Kandidat yang rutenya
+    // sudah ada dihitung sebagai dilewati; sisanya dinormalisasi menjadi
+    // pasangan tak berarah dan dibuang duplikatnya. Kedua arah setiap
+    // pasangan lalu ditambahkan ke graf dalam satu addRoutesBulk, terurut
+    // menurut asal. Hasilnya sama dengan menambah rute satu per satu dan
+    // tidak bergantung pada jumlah thread maupun urutan pemrosesan.
+    template <typename FillBlock>
+    pair<int, int> generateFromCandidates(const vector<const LocationEntry*>& sorted,
+                                          const CoordinateStore& coordinates,
+                                          const unordered_set<uint64_t>& edges,
+                                          size_t itemCount, FillBlock fillBlock,
+                                          double timeMultiplier, double costMultiplier,
+                                          ThreadPool& pool, size_t blockCount) {
+        vector<vector<uint64_t>> buffers(blockCount);
+        vector<size_t> candidateCounts(blockCount, 0);
+        forEachBlock(pool, itemCount, blockCount, [&](size_t block, size_t first, size_t last) {
+            vector<uint64_t>& buffer = buffers[block];
+            fillBlock(first, last, buffer);
+            candidateCounts[block] = buffer.size();
             
-            sort(distances.begin(), distances.end());
-            int maxConnections = min(3, static_cast<int>(distances.size()));
-            
-            for (int i = 0; i < maxConnections; ++i) {
-                string destName = distances[i].second;
-                
-                if (routeExists(source.first, destName)) {
-                    routesSkipped++;
-                    continue;
-                }
-                
-                double distance = distances[i].first;
-                double time = distance * timeMultiplier;
-                double cost = distance * costMultiplier;
-                  if (graph.addRoute(source.first, destName, time, cost)) {
-                    routesCreated++;
-                    // Tambah rute balik untuk membuat graf bidirectional
-                    if (graph.addRoute(destName, source.first, time, cost)) {
-                        routesCreated++;
-                    }
-                }
+            size_t kept = 0;
+            for (uint64_t key : buffer) {
+                if (edges.count(key)) continue;
+                uint32_t sourceId = static_cast<uint32_t>(key >> 32);
+                uint32_t destId = static_cast<uint32_t>(key);
+                buffer[kept++] = edgeKey(min(sourceId, destId), max(sourceId, destId));
             }
-        }
+            buffer.resize(kept);
+        });
+        vector<uint64_t> pairs = sortAndMerge(buffers, pool);
+        
+        size_t candidateCount = 0;
+        for (size_t count : candidateCounts) candidateCount += count;
+        
+        // Kedua arah setiap pasangan yang belum ada, diurutkan ulang menurut asal
+        vector<vector<uint64_t>> directed(blockCount);
+        forEachBlock(pool, pairs.size(), blockCount, [&](size_t block, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                uint64_t forward = pairs[i];
+                uint64_t backward = edgeKey(static_cast<uint32_t>(forward), static_cast<uint32_t>(forward >> 32));
+                if (!edges.count(forward)) directed[block].push_back(forward);
+                if (!edges.count(backward)) directed[block].push_back(backward);
+            }
+        });
+        vector<uint64_t> routeKeys = sortAndMerge(directed, pool);
+        
+        // Jarak semua rute dihitung per blok dari kolom koordinat
+        vector<Route> routes(routeKeys.size());
+        forEachBlock(pool, routeKeys.size(), blockCount, [&](size_t, size_t first, size_t last) {
+            vector<uint32_t> from(last - first), to(last - first);
+            for (size_t i = first; i < last; ++i) {
+                from[i - first] = static_cast<uint32_t>(routeKeys[i] >> 32);
+                to[i - first] = static_cast<uint32_t>(routeKeys[i]);
+            }
+            vector<double> distances(last - first);
+            coordinates.distancesBetween(from.data(), to.data(), distances.size(), distances.data());
+            for (size_t i = first; i < last; ++i) {
+                double distance = distances[i - first];
+                routes[i] = Route(sorted[from[i - first]]->first, sorted[to[i - first]]->first, distance,
+                                  distance * timeMultiplier, distance * costMultiplier);
+            }
+        });
         
+        int routesCreated = static_cast<int>(graph.addRoutesBulk(routes, &pool));
+        int routesSkipped = static_cast<int>(candidateCount - pairs.size());
         return {routesCreated, routesSkipped};
     }
     
-    pair<int, int> generateRadiusBasedRoutes(double timeMultiplier, double costMultiplier, double maxRadius) {
-        const auto& locations = graph.getLocations();
-        int routesCreated = 0;
-        int routesSkipped = 0;
+    // Tetangga terdekat dicari lewat k-d tree (O(log n) per kota) alih-alih
+    // mengurutkan jarak ke semua kota lain. ID mengikuti urutan nama, jadi
+    // jarak yang sama tetap dipecah berdasarkan nama seperti sebelumnya.
+    pair<int, int> generateNearestNeighborRoutes(double timeMultiplier, double costMultiplier) {
+        cout << "\n🌐 Menggunakan metode koneksi berdasarkan jarak terdekat (max " << neighborCount
+             << " koneksi per kota)" << endl;
+        
+        size_t locationCount = graph.getLocationCount();
+        size_t workers = max<size_t>(1, min(workerCount(), locationCount));
+        // Beberapa blok per thread agar beban tetap seimbang
+        size_t blockCount = workers == 1 ? 1 : min(locationCount, workers * 4);
+        ThreadPool pool(workers);
+        
+        vector<const LocationEntry*> sorted;
+        CoordinateStore coordinates;
+        unordered_set<uint64_t> edges;
+        indexLocations(sorted, coordinates, edges, pool, blockCount);
+        
+        vector<KdTree::Point> points(sorted.size());
+        for (uint32_t id = 0; id < sorted.size(); ++id) {
+            points[id] = { coordinates.getX(id), coordinates.getY(id), id };
+        }
+        KdTree tree(points);
+        
+        // Kota diproses dalam urutan penyimpanan pohon agar query ramah cache
+        const vector<KdTree::Point>& treePoints = tree.getPoints();
+        vector<uint32_t> sources(treePoints.size());
+        for (size_t i = 0; i < treePoints.size(); ++i) sources[i] = treePoints[i].id;
         
+        size_t k = neighborCount;
+        return generateFromCandidates(sorted, coordinates, edges, sources.size(),
+            [&](size_t first, size_t last, vector<uint64_t>& buffer) {
+                vector<KdTree::Neighbor> nearest;
+                for (size_t i = first; i < last; ++i) {
+                    const KdTree::Point& point = treePoints[i];
+                    tree.nearest(point.x, point.y, k, point.id, nearest);
+                    for (const KdTree::Neighbor& neighbor : nearest) {
+                        buffer.push_back(edgeKey(point.id, neighbor.second));
+                    }
+                }
+            }, timeMultiplier, costMultiplier, pool, blockCount);
+    }
+    
+    // Kota dikelompokkan dalam grid dengan sel selebar radius, sehingga setiap
+    // kota hanya dibandingkan dengan kota di selnya dan delapan sel sekitarnya.
+    // Waktu berjalan sebanding dengan jumlah pasangan yang berdekatan, bukan n².
+    // Koordinat disalin dalam urutan grid agar sel-sel yang bersebelahan
+    // menjadi satu blok memori untuk kernel jarak.
+    pair<int, int> generateRadiusBasedRoutes(double timeMultiplier, double costMultiplier, double maxRadius) {
         cout << "\n📏 Menggunakan metode koneksi kota dalam radius " << maxRadius << " km" << endl;
+        if (!(maxRadius >= 0)) return {0, 0};
         
-        for (const auto& source : locations) {
-            for (const auto& dest : locations) {
-                if (source.first == dest.first) continue;
-                
-                double distance = source.second.distanceTo(dest.second);
-                if (distance > maxRadius) continue;
-                
-                if (routeExists(source.first, dest.first)) {
-                    routesSkipped++;
-                    continue;
+        size_t locationCount = graph.getLocationCount();
+        size_t workers = max<size_t>(1, min(workerCount(), locationCount));
+        size_t blockCount = workers == 1 ? 1 : min(locationCount, workers * 4);
+        ThreadPool pool(workers);
+        
+        vector<const LocationEntry*> sorted;
+        CoordinateStore coordinates;
+        unordered_set<uint64_t> edges;
+        indexLocations(sorted, coordinates, edges, pool, blockCount);
+        
+        SpatialGrid grid(coordinates.getXs(), coordinates.getYs(), maxRadius);
+        const vector<uint32_t>& sources = grid.getOrder();
+        CoordinateStore gridOrdered = coordinates.permuted(sources);
+        
+        return generateFromCandidates(sorted, coordinates, edges, sources.size(),
+            [&](size_t first, size_t last, vector<uint64_t>& buffer) {
+                vector<double> distances;
+                for (size_t i = first; i < last; ++i) {
+                    uint32_t sourceId = sources[i];
+                    double x = gridOrdered.getX(static_cast<uint32_t>(i));
+                    double y = gridOrdered.getY(static_cast<uint32_t>(i));
+                    grid.forEachRangeNear(x, y, [&](uint32_t rangeFirst, uint32_t rangeLast) {
+                        distances.resize(rangeLast - rangeFirst);
+                        gridOrdered.distancesFrom(x, y, rangeFirst, rangeLast, distances.data());
+                        for (uint32_t j = rangeFirst; j < rangeLast; ++j) {
+                            if (j == i || distances[j - rangeFirst] > maxRadius) continue;
+                            buffer.push_back(edgeKey(sourceId, sources[j]));
+                        }
+                    });
                 }
-                
-                double time = distance * timeMultiplier;
-                double cost = distance * costMultiplier;
-                  if (graph.addRoute(source.first, dest.first, time, cost)) {
-                    routesCreated++;
-                    // Tambah rute balik untuk membuat graf bidirectional  
-                    if (graph.addRoute(dest.first, source.first, time, cost)) {
-                        routesCreated++;
-                    }
+            }, timeMultiplier, costMultiplier, pool, blockCount);
+    }
+    
+    // Edge triangulasi Delaunay dari koordinat kota, opsional dipangkas
+    // menjadi Gabriel graph atau relative neighbourhood graph. Kota yang
+    // tidak masuk triangulasi (koordinat kembar, atau titik yang hampir
+    // segaris sehingga dilewati secara numerik) dihubungkan ke kota
+    // terdekat yang masuk, jadi hasilnya selalu terhubung.
+    pair<int, int> generateDelaunayRoutes(double timeMultiplier, double costMultiplier) {
+        static const char* const pruningNames[] = { "tanpa pemangkasan", "Gabriel graph",
+                                                    "relative neighbourhood graph" };
+        cout << "\n🔺 Menggunakan metode koneksi triangulasi Delaunay ("
+             << pruningNames[static_cast<int>(delaunayPruning)] << ")" << endl;
+        
+        size_t locationCount = graph.getLocationCount();
+        size_t workers = max<size_t>(1, min(workerCount(), locationCount));
+        size_t blockCount = workers == 1 ? 1 : min(locationCount, workers * 4);
+        ThreadPool pool(workers);
+        
+        vector<const LocationEntry*> sorted;
+        CoordinateStore coordinates;
+        unordered_set<uint64_t> edges;
+        indexLocations(sorted, coordinates, edges, pool, blockCount);
+        
+        const vector<double>& xs = coordinates.getXs();
+        const vector<double>& ys = coordinates.getYs();
+        DelaunayTriangulation triangulation(xs, ys);
+        const vector<uint32_t>& triangles = triangulation.getTriangles();
+        const vector<uint32_t>& halfedges = triangulation.getHalfedges();
+        const vector<uint32_t>& chain = triangulation.getCollinearChain();
+        
+        // Edge tambahan: rantai titik segaris dan kota di luar triangulasi
+        vector<char> included(sorted.size(), 0);
+        for (uint32_t vertex : triangles) included[vertex] = 1;
+        for (uint32_t vertex : chain) included[vertex] = 1;
+        vector<uint64_t> extraEdges;
+        for (size_t i = 1; i < chain.size(); ++i) {
+            extraEdges.push_back(edgeKey(chain[i - 1], chain[i]));
+        }
+        vector<KdTree::Point> points;
+        for (uint32_t id = 0; id < sorted.size(); ++id) {
+            if (included[id]) points.push_back({ xs[id], ys[id], id });
+        }
+        KdTree includedTree(points);
+        vector<KdTree::Neighbor> nearest;
+        for (uint32_t id = 0; id < sorted.size(); ++id) {
+            if (included[id]) continue;
+            includedTree.nearest(xs[id], ys[id], 1, id, nearest);
+            if (!nearest.empty()) extraEdges.push_back(edgeKey(id, nearest[0].second));
+        }
+        
+        DelaunayPruning pruning = delaunayPruning;
+        auto keep = [&](uint32_t edge) {
+            uint32_t a = triangles[edge];
+            uint32_t b = triangles[DelaunayTriangulation::nextHalfedge(edge)];
+            if (pruning == DelaunayPruning::GABRIEL) {
+                // Cukup memeriksa titik di seberang edge pada kedua segitiga
+                // yang mengapitnya: sudutnya harus lancip
+                uint32_t twin = halfedges[edge];
+                for (uint32_t e : { edge, twin }) {
+                    if (e == DelaunayTriangulation::INVALID) continue;
+                    uint32_t c = triangles[DelaunayTriangulation::prevHalfedge(e)];
+                    double dot = (xs[a] - xs[c]) * (xs[b] - xs[c]) + (ys[a] - ys[c]) * (ys[b] - ys[c]);
+                    if (dot < 0) return false;
+                }
+            } else if (pruning == DelaunayPruning::RELATIVE_NEIGHBORHOOD) {
+                // Kota di dalam "lune": lebih dekat ke a dan ke b daripada a ke b
+                double dx = xs[a] - xs[b], dy = ys[a] - ys[b];
+                double length = dx * dx + dy * dy;
+                auto inLune = [&](const KdTree::Point& w) {
+                    double ax = w.x - xs[a], ay = w.y - ys[a];
+                    double bx = w.x - xs[b], by = w.y - ys[b];
+                    return ax * ax + ay * ay < length && bx * bx + by * by < length;
+                };
+                if (includedTree.anyWithin((xs[a] + xs[b]) / 2, (ys[a] + ys[b]) / 2, sqrt(length), inLune)) {
+                    return false;
                 }
             }
+            return true;
+        };
+        
+        // Setiap edge dalam diambil sekali, dari halfedge dengan indeks lebih kecil
+        vector<vector<uint64_t>> keptBlocks(blockCount), prunedBlocks(blockCount);
+        forEachBlock(pool, halfedges.size(), blockCount, [&](size_t block, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                uint32_t edge = static_cast<uint32_t>(i);
+                if (halfedges[edge] != DelaunayTriangulation::INVALID && halfedges[edge] < edge) continue;
+                uint64_t key = edgeKey(triangles[edge], triangles[DelaunayTriangulation::nextHalfedge(edge)]);
+                (keep(edge) ? keptBlocks : prunedBlocks)[block].push_back(key);
+            }
+        });
+        vector<uint64_t> candidates = extraEdges;
+        for (const vector<uint64_t>& block : keptBlocks) {
+            candidates.insert(candidates.end(), block.begin(), block.end());
         }
         
-        return {routesCreated, routesSkipped};
+        // Pada triangulasi Delaunay yang tepat, Gabriel graph dan relative
+        // neighbourhood graph selalu terhubung. Jika koordinat yang hampir
+        // segaris membuat triangulasinya tidak tepat, edge yang dipangkas
+        // dikembalikan dari yang terpendek hanya bila menyambung dua komponen.
+        if (pruning != DelaunayPruning::NONE) {
+            vector<uint32_t> parent(sorted.size());
+            iota(parent.begin(), parent.end(), 0);
+            auto find = [&parent](uint32_t x) {
+                while (parent[x] != x) x = parent[x] = parent[parent[x]];
+                return x;
+            };
+            for (uint64_t key : candidates) {
+                parent[find(static_cast<uint32_t>(key >> 32))] = find(static_cast<uint32_t>(key));
+            }
+            
+            vector<pair<double, uint64_t>> pruned;
+            for (const vector<uint64_t>& block : prunedBlocks) {
+                for (uint64_t key : block) {
+                    uint32_t a = static_cast<uint32_t>(key >> 32), b = static_cast<uint32_t>(key);
+                    if (find(a) == find(b)) continue;
+                    double dx = xs[a] - xs[b], dy = ys[a] - ys[b];
+                    pruned.push_back(make_pair(dx * dx + dy * dy, key));
+                }
+            }
+            sort(pruned.begin(), pruned.end());
+            size_t restored = 0;
+            for (const auto& entry : pruned) {
+                uint32_t a = find(static_cast<uint32_t>(entry.second >> 32));
+                uint32_t b = find(static_cast<uint32_t>(entry.second));
+                if (a == b) continue;
+                parent[a] = b;
+                candidates.push_back(entry.second);
+                ++restored;
+            }
+            if (restored > 0) {
+                cout << "⚠️  " << restored << " edge triangulasi dikembalikan agar graf tetap terhubung" << endl;
+            }
+        }
+        
+        return generateFromCandidates(sorted, coordinates, edges, candidates.size(),
+            [&](size_t first, size_t last, vector<uint64_t>& buffer) {
+                buffer.insert(buffer.end(), candidates.begin() + first, candidates.begin() + last);
+            }, timeMultiplier, costMultiplier, pool, blockCount);
     }
     
     bool routeExists(const string& sourceName, const string& destName) const {
@@ -0,0 +1,293 @@
+#ifndef BATCH_QUERY_RUNNER_H
+#define BATCH_QUERY_RUNNER_H
+
+#include "GraphManager.h"
+#include "DijkstraAlgorithm.h"
+#include "PreferenceManager.h"
+#include "ThreadPool.h"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+
+using namespace std;
+
+// Satu baris file query batch
+struct BatchQuery {
+    size_t id;          // nomor urut query (mulai 0), juga urutan output
+    size_t lineNumber;
+    string start;
+    string end;
+    string mode;        // jarak / waktu / biaya, atau "preferensi"
+    int priorities[3];  // prioritas waktu, biaya, jarak untuk mode preferensi
+
+    BatchQuery() : id(0), lineNumber(0), priorities{1, 2, 3} {}
+};
+
+struct BatchSummary {
+    size_t queryCount;
+    size_t foundCount;
+    double wallMs;
+    double p50Ms;
+    double p95Ms;
+    double p99Ms;
+    double maxMs;
+
+    BatchSummary() : queryCount(0), foundCount(0), wallMs(0), p50Ms(0), p95Ms(0), p99Ms(0), maxMs(0) {}
+
+    double throughput() const { return wallMs > 0 ? queryCount * 1000.0 / wallMs : 0; }
+};
+
+// Menjalankan banyak query rute secara paralel di thread pool atas satu graf
+// yang tidak sedang diedit. Setiap worker punya DijkstraAlgorithm sendiri
+// (workspace dan cache tidak dibagi) yang membaca snapshot CSR bersama.
+// Hasil ditulis bertahap dalam urutan query yang sama dengan file input,
+// sebagai CSV atau JSONL, lengkap dengan latensi per query.
+//
+// Format file query (satu query per baris, '#' untuk komentar):
+//   asal,tujuan,jarak|waktu|biaya
+//   asal,tujuan,preferensi,prioritasWaktu,prioritasBiaya,prioritasJarak
+class BatchQueryRunner {
+public:
+    enum class OutputFormat {
+        CSV,
+        JSONL
+    };
+
+private:
+    const GraphManager& graph;
+    size_t threadCount;
+    OutputFormat format;
+
+    static string trim(const string& text) {
+        size_t first = text.find_first_not_of(" \t\r");
+        if (first == string::npos) return "";
+        size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+
+    static bool parseLine(const string& line, BatchQuery& query) {
+        stringstream ss(line);
+        vector<string> fields;
+        string field;
+        while (getline(ss, field, ',')) {
+            fields.push_back(trim(field));
+        }
+        if (fields.size() < 3 || fields[0].empty() || fields[1].empty()) return false;
+
+        query.start = fields[0];
+        query.end = fields[1];
+        query.mode = fields[2];
+        if (query.mode == "preferensi") {
+            if (fields.size() != 6) return false;
+            for (int k = 0; k < 3; ++k) {
+                try {
+                    query.priorities[k] = stoi(fields[3 + k]);
+                } catch (const exception& e) {
+                    return false;
+                }
+                if (query.priorities[k] < 1 || query.priorities[k] > 3) return false;
+            }
+            return true;
+        }
+
+        CSRGraph::WeightColumn column;
+        return fields.size() == 3 && CSRGraph::parseMode(query.mode, column);
+    }
+
+    static string csvField(const string& text) {
+        if (text.find_first_of(",\"\n") == string::npos) return text;
+        string quoted = "\"";
+        for (char c : text) {
+            if (c == '"') quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    static string jsonString(const string& text) {
+        ostringstream json;
+        json << '"';
+        for (char c : text) {
+            switch (c) {
+                case '"': json << "\\\""; break;
+                case '\\': json << "\\\\"; break;
+                case '\n': json << "\\n"; break;
+                case '\t': json << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        json << "\\u" << hex << setw(4) << setfill('0') << static_cast<int>(c) << dec;
+                    } else {
+                        json << c;
+                    }
+            }
+        }
+        json << '"';
+        return json.str();
+    }
+
+    static string criterionOf(const BatchQuery& query) {
+        if (query.mode != "preferensi") return query.mode;
+        return "preferensi(" + to_string(query.priorities[0]) + "-" + to_string(query.priorities[1]) +
+               "-" + to_string(query.priorities[2]) + ")";
+    }
+
+    string formatResult(const BatchQuery& query, const PathResult& result, double latencyMs) const {
+        bool found = !result.path.empty();
+        ostringstream line;
+        line << fixed;
+        if (format == OutputFormat::JSONL) {
+            line << "{\"id\":" << query.id
+                 << ",\"start\":" << jsonString(query.start)
+                 << ",\"end\":" << jsonString(query.end)
+                 << ",\"criterion\":" << jsonString(criterionOf(query))
+                 << ",\"found\":" << (found ? "true" : "false")
+                 << ",\"total_cost\":" << setprecision(4) << result.totalCost
+                 << ",\"hops\":" << (found ? result.path.size() - 1 : 0)
+                 << ",\"settled_nodes\":" << result.settledNodes
+                 << ",\"latency_ms\":" << setprecision(3) << latencyMs
+                 << ",\"path\":[";
+            for (size_t i = 0; i < result.path.size(); ++i) {
+                if (i > 0) line << ",";
+                line << jsonString(result.path[i]);
+            }
+            line << "]}";
+        } else {
+            string path;
+            for (size_t i = 0; i < result.path.size(); ++i) {
+                if (i > 0) path += ">";
+                path += result.path[i];
+            }
+            line << query.id << "," << csvField(query.start) << "," << csvField(query.end) << ","
+                 << csvField(criterionOf(query)) << "," << (found ? 1 : 0) << ","
+                 << setprecision(4) << result.totalCost << "," << (found ? result.path.size() - 1 : 0) << ","
+                 << result.settledNodes << "," << setprecision(3) << latencyMs << "," << csvField(path);
+        }
+        return line.str();
+    }
+
+    static double percentile(const vector<double>& sorted, double fraction) {
+        if (sorted.empty()) return 0;
+        size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+        return sorted[min(index, sorted.size() - 1)];
+    }
+
+public:
+    BatchQueryRunner(const GraphManager& graph, size_t threadCount = 0,
+                     OutputFormat format = OutputFormat::CSV)
+        : graph(graph),
+          threadCount(threadCount == 0 ? ThreadPool::defaultThreadCount() : threadCount),
+          format(format) {}
+
+    static bool parseFormat(const string& name, OutputFormat& format) {
+        if (name == "csv") format = OutputFormat::CSV;
+        else if (name == "jsonl") format = OutputFormat::JSONL;
+        else return false;
+        return true;
+    }
+
+    // Baris yang tidak valid dilaporkan ke cerr lalu dilewati
+    vector<BatchQuery> readQueries(istream& in) const {
+        vector<BatchQuery> queries;
+        string line;
+        size_t lineNumber = 0;
+        while (getline(in, line)) {
+            ++lineNumber;
+            string content = trim(line);
+            if (content.empty() || content[0] == '#') continue;
+
+            BatchQuery query;
+            query.lineNumber = lineNumber;
+            if (!parseLine(content, query)) {
+                // Baris judul kolom tidak dianggap error
+                if (queries.empty() && (content.compare(0, 5, "asal,") == 0 || content.compare(0, 6, "start,") == 0)) {
+                    continue;
+                }
+                cerr << "⚠️  Baris " << lineNumber << " tidak valid, dilewati: " << content << endl;
+                continue;
+            }
+            query.id = queries.size();
+            queries.push_back(query);
+        }
+        return queries;
+    }
+
+    BatchSummary run(const vector<BatchQuery>& queries, ostream& out) {
+        BatchSummary summary;
+        summary.queryCount = queries.size();
+
+        if (format == OutputFormat::CSV) {
+            out << "id,start,end,criterion,found,total_cost,hops,settled_nodes,latency_ms,path" << '\n';
+        }
+        if (queries.empty()) return summary;
+
+        graph.getSnapshot();  // dibangun sekali sebelum worker mulai
+
+        size_t workerCount = max<size_t>(1, min(threadCount, queries.size()));
+        vector<string> lines(queries.size());
+        vector<char> ready(queries.size(), 0);
+        vector<double> latencies(queries.size(), 0);
+        size_t nextToWrite = 0;
+        mutex outputMutex;
+        atomic<size_t> nextQuery(0);
+        atomic<size_t> foundCount(0);
+
+        auto wallStart = chrono::steady_clock::now();
+        {
+            ThreadPool pool(workerCount);
+            for (size_t w = 0; w < workerCount; ++w) {
+                pool.submit([&]() {
+                    // Pesan engine dibungkam per instance; cout global tidak disentuh
+                    DijkstraAlgorithm dijkstra(graph);
+                    dijkstra.setSnapshotIsolation(true);
+                    dijkstra.setVerbose(false);
+                    PreferenceManager pref;
+
+                    // Query diambil satu per satu agar beban worker tetap seimbang
+                    for (size_t i = nextQuery++; i < queries.size(); i = nextQuery++) {
+                        const BatchQuery& query = queries[i];
+                        auto start = chrono::steady_clock::now();
+                        PathResult result;
+                        if (query.mode == "preferensi") {
+                            pref.setPriorities(query.priorities[0], query.priorities[1], query.priorities[2]);
+                            result = dijkstra.findBestRouteWithPreference(query.start, query.end, pref);
+                        } else {
+                            result = dijkstra.findShortestPath(query.start, query.end, query.mode);
+                        }
+                        double latencyMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                        if (!result.path.empty()) ++foundCount;
+                        string line = formatResult(query, result, latencyMs);
+
+                        lock_guard<mutex> lock(outputMutex);
+                        lines[i] = move(line);
+                        ready[i] = 1;
+                        latencies[i] = latencyMs;
+                        while (nextToWrite < queries.size() && ready[nextToWrite]) {
+                            out << lines[nextToWrite] << '\n';
+                            string().swap(lines[nextToWrite]);
+                            ++nextToWrite;
+                        }
+                    }
+                });
+            }
+            pool.wait();
+        }
+        summary.wallMs = chrono::duration<double, milli>(chrono::steady_clock::now() - wallStart).count();
+        out.flush();
+
+        summary.foundCount = foundCount.load();
+        sort(latencies.begin(), latencies.end());
+        summary.p50Ms = percentile(latencies, 0.50);
+        summary.p95Ms = percentile(latencies, 0.95);
+        summary.p99Ms = percentile(latencies, 0.99);
+        summary.maxMs = latencies.back();
+        return summary;
+    }
+};
+
+#endif
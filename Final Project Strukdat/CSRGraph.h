@@ -0,0 +1,225 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "Location.h"
+#include "Route.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <cmath>
+
+using namespace std;
+
+// Snapshot graf yang tidak bisa diubah (immutable) dalam format
+// Compressed Sparse Row. Setiap lokasi mendapat ID integer yang rapat
+// (0..V-1) sehingga algoritma pencarian tidak perlu melakukan hashing
+// string untuk setiap edge yang direlaksasi.
+class CSRGraph {
+public:
+    static constexpr uint32_t INVALID_NODE = numeric_limits<uint32_t>::max();
+
+    enum class WeightColumn {
+        JARAK,
+        WAKTU,
+        BIAYA
+    };
+
+private:
+    vector<string> names;
+    unordered_map<string, uint32_t> nameToId;
+    vector<double> xs;
+    vector<double> ys;
+
+    vector<uint32_t> offsets;      // ukuran V + 1, edge milik node u ada di [offsets[u], offsets[u+1])
+    vector<uint32_t> targets;      // ukuran E
+    vector<double> distanceWeights;
+    vector<double> timeWeights;
+    vector<double> costWeights;
+
+    // Tampilan balik (incoming edge) untuk pencarian mundur. reverseEdges
+    // menyimpan indeks edge maju sehingga kolom bobot tidak diduplikasi.
+    vector<uint32_t> reverseOffsets;
+    vector<uint32_t> reverseSources;
+    vector<uint32_t> reverseEdges;
+
+    // Rasio bobot per km terkecil untuk setiap kolom, dipakai sebagai
+    // pengali heuristik A* (indeks sesuai WeightColumn)
+    double minWeightPerKm[3];
+
+    unsigned long long version;
+    unsigned long long topologyVersion;  // versi terakhir saat node/edge berubah
+
+public:
+    CSRGraph() : offsets(1, 0), reverseOffsets(1, 0), minWeightPerKm{1, 0, 0}, version(0), topologyVersion(0) {}
+
+    CSRGraph(const unordered_map<string, Location>& locations,
+             const unordered_map<string, vector<Route>>& adjacencyList,
+             unsigned long long version)
+        : version(version), topologyVersion(version) {
+        names.reserve(locations.size());
+        for (const auto& pair : locations) {
+            names.push_back(pair.first);
+        }
+        // Urutan ID dibuat deterministik agar hasil tie-breaking stabil
+        sort(names.begin(), names.end());
+
+        uint32_t nodeCount = static_cast<uint32_t>(names.size());
+        nameToId.reserve(nodeCount);
+        xs.resize(nodeCount);
+        ys.resize(nodeCount);
+        for (uint32_t id = 0; id < nodeCount; ++id) {
+            nameToId.emplace(names[id], id);
+            const Location& loc = locations.at(names[id]);
+            xs[id] = loc.getX();
+            ys[id] = loc.getY();
+        }
+
+        offsets.assign(nodeCount + 1, 0);
+        for (uint32_t id = 0; id < nodeCount; ++id) {
+            auto it = adjacencyList.find(names[id]);
+            size_t degree = (it == adjacencyList.end()) ? 0 : it->second.size();
+            offsets[id + 1] = offsets[id] + static_cast<uint32_t>(degree);
+        }
+
+        size_t edgeCount = offsets[nodeCount];
+        targets.reserve(edgeCount);
+        distanceWeights.reserve(edgeCount);
+        timeWeights.reserve(edgeCount);
+        costWeights.reserve(edgeCount);
+
+        for (uint32_t id = 0; id < nodeCount; ++id) {
+            auto it = adjacencyList.find(names[id]);
+            if (it == adjacencyList.end()) continue;
+
+            for (const Route& route : it->second) {
+                targets.push_back(nameToId.at(route.getDestination()));
+                distanceWeights.push_back(route.getDistance());
+                timeWeights.push_back(route.getTime());
+                costWeights.push_back(route.getCost());
+            }
+        }
+
+        buildReverseView();
+        computeMinWeightPerKm();
+    }
+
+    // Salinan base dengan bobot waktu/biaya beberapa rute diganti. Topologi
+    // tidak berubah, jadi jauh lebih murah daripada membangun ulang dari
+    // GraphManager (dipakai saat hanya ada updateRoute sejak snapshot terakhir).
+    CSRGraph(const CSRGraph& base, const vector<Route>& updatedRoutes, unsigned long long version)
+        : CSRGraph(base) {
+        this->version = version;
+        for (const Route& route : updatedRoutes) {
+            uint32_t source = getId(route.getSource());
+            uint32_t target = getId(route.getDestination());
+            if (source == INVALID_NODE || target == INVALID_NODE) continue;
+            for (uint32_t e = offsets[source]; e < offsets[source + 1]; ++e) {
+                if (targets[e] == target) {
+                    timeWeights[e] = route.getTime();
+                    costWeights[e] = route.getCost();
+                }
+            }
+        }
+        computeMinWeightPerKm();
+    }
+
+private:
+    void buildReverseView() {
+        uint32_t nodeCount = getNodeCount();
+        reverseOffsets.assign(nodeCount + 1, 0);
+        for (uint32_t target : targets) {
+            ++reverseOffsets[target + 1];
+        }
+        for (uint32_t id = 0; id < nodeCount; ++id) {
+            reverseOffsets[id + 1] += reverseOffsets[id];
+        }
+
+        reverseSources.resize(targets.size());
+        reverseEdges.resize(targets.size());
+        vector<uint32_t> cursor(reverseOffsets.begin(), reverseOffsets.end() - 1);
+        for (uint32_t source = 0; source < nodeCount; ++source) {
+            for (uint32_t e = offsets[source]; e < offsets[source + 1]; ++e) {
+                uint32_t slot = cursor[targets[e]]++;
+                reverseSources[slot] = source;
+                reverseEdges[slot] = e;
+            }
+        }
+    }
+
+    void computeMinWeightPerKm() {
+        double minTime = numeric_limits<double>::infinity();
+        double minCost = numeric_limits<double>::infinity();
+        for (size_t e = 0; e < targets.size(); ++e) {
+            if (distanceWeights[e] <= 0) continue;
+            minTime = min(minTime, timeWeights[e] / distanceWeights[e]);
+            minCost = min(minCost, costWeights[e] / distanceWeights[e]);
+        }
+
+        // Jarak rute selalu sama dengan jarak garis lurus (lihat GraphManager::addRoute)
+        minWeightPerKm[0] = 1.0;
+        minWeightPerKm[1] = (minTime == numeric_limits<double>::infinity()) ? 0 : max(0.0, minTime);
+        minWeightPerKm[2] = (minCost == numeric_limits<double>::infinity()) ? 0 : max(0.0, minCost);
+    }
+
+public:
+    static bool parseMode(const string& mode, WeightColumn& column) {
+        if (mode == "jarak") column = WeightColumn::JARAK;
+        else if (mode == "waktu") column = WeightColumn::WAKTU;
+        else if (mode == "biaya") column = WeightColumn::BIAYA;
+        else return false;
+        return true;
+    }
+
+    uint32_t getNodeCount() const { return static_cast<uint32_t>(names.size()); }
+    uint32_t getEdgeCount() const { return static_cast<uint32_t>(targets.size()); }
+    unsigned long long getVersion() const { return version; }
+    // Sama untuk snapshot yang hanya berbeda bobot (lihat konstruktor patch),
+    // sehingga preprocessing yang hanya bergantung topologi bisa dipakai ulang
+    unsigned long long getTopologyVersion() const { return topologyVersion; }
+
+    uint32_t getId(const string& name) const {
+        auto it = nameToId.find(name);
+        return it == nameToId.end() ? INVALID_NODE : it->second;
+    }
+
+    const string& getName(uint32_t id) const { return names[id]; }
+    double getX(uint32_t id) const { return xs[id]; }
+    double getY(uint32_t id) const { return ys[id]; }
+
+    uint32_t edgeBegin(uint32_t id) const { return offsets[id]; }
+    uint32_t edgeEnd(uint32_t id) const { return offsets[id + 1]; }
+    uint32_t getTarget(uint32_t edge) const { return targets[edge]; }
+
+    uint32_t reverseBegin(uint32_t id) const { return reverseOffsets[id]; }
+    uint32_t reverseEnd(uint32_t id) const { return reverseOffsets[id + 1]; }
+    uint32_t getReverseSource(uint32_t slot) const { return reverseSources[slot]; }
+    uint32_t getReverseEdge(uint32_t slot) const { return reverseEdges[slot]; }
+
+    const vector<double>& getWeights(WeightColumn column) const {
+        switch (column) {
+            case WeightColumn::WAKTU: return timeWeights;
+            case WeightColumn::BIAYA: return costWeights;
+            case WeightColumn::JARAK:
+            default: return distanceWeights;
+        }
+    }
+
+    double getMinWeightPerKm(WeightColumn column) const {
+        return minWeightPerKm[static_cast<int>(column)];
+    }
+
+    double straightLineDistance(uint32_t a, uint32_t b) const {
+        double dx = xs[a] - xs[b];
+        double dy = ys[a] - ys[b];
+        return sqrt(dx * dx + dy * dy);
+    }
+
+    double getDistance(uint32_t edge) const { return distanceWeights[edge]; }
+    double getTime(uint32_t edge) const { return timeWeights[edge]; }
+    double getCost(uint32_t edge) const { return costWeights[edge]; }
+};
+
+#endif
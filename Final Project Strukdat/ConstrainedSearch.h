@@ -0,0 +1,145 @@
+#ifndef CONSTRAINED_SEARCH_H
+#define CONSTRAINED_SEARCH_H
+
+#include "CSRGraph.h"
+#include "SearchWorkspace.h"
+#include <vector>
+#include <queue>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Resource-constrained shortest path: minimumkan kriteria utama (misalnya
+// waktu) dengan syarat total kriteria lain (misalnya biaya) <= anggaran.
+//
+// Label (utama, sumber daya) disimpan di arena. Dua Dijkstra mundur dari
+// tujuan memberi batas bawah kedua kriteria: batas sumber daya membuang
+// label yang pasti melebihi anggaran, batas utama menjadi potensial A*.
+// Karena antrian terurut menurut kunci utama, label permanen di sebuah node
+// selalu tidak lebih buruk pada kriteria utama, sehingga dominasi cukup
+// diuji dengan sumber daya terkecil yang sudah permanen di node itu. Label
+// pertama yang mencapai tujuan adalah jawaban optimal.
+//
+// Seperti ParetoSearch, jumlah label di arena dibatasi maxLabels; jika
+// batas tercapai sebelum tujuan dicapai, pencarian berhenti dengan
+// truncated = true dan tidak ada rute yang dikembalikan.
+class ConstrainedSearch {
+private:
+    static constexpr uint32_t NO_LABEL = numeric_limits<uint32_t>::max();
+
+    struct Label {
+        double primary;
+        double resource;
+        uint32_t node;
+        uint32_t parent;
+    };
+
+    struct QueueEntry {
+        double key;
+        double resource;
+        uint32_t label;
+
+        bool operator>(const QueueEntry& other) const {
+            if (key != other.key) return key > other.key;
+            return resource > other.resource;
+        }
+    };
+
+    vector<Label> arena;
+    vector<double> minResource;  // sumber daya terkecil label permanen per node
+    vector<uint32_t> touchedNodes;
+    vector<double> primaryBound;
+    vector<double> resourceBound;
+    SearchWorkspace boundWorkspace;
+
+    void reverseDistances(const CSRGraph& csr, const double* weights, uint32_t endId, vector<double>& out) {
+        SearchWorkspace& ws = boundWorkspace;
+        ws.reset(csr.getNodeCount());
+        ws.improve(endId, 0, CSRGraph::INVALID_NODE);
+        while (!ws.heap.empty()) {
+            uint32_t u = ws.heap.pop();
+            for (uint32_t slot = csr.reverseBegin(u); slot < csr.reverseEnd(u); ++slot) {
+                ws.improve(csr.getReverseSource(slot), ws.cost[u] + weights[csr.getReverseEdge(slot)], u);
+            }
+        }
+        out.assign(ws.cost.begin(), ws.cost.end());
+    }
+
+public:
+    // Mengisi path (ID node) dan resourceUsed, mengembalikan biaya utama;
+    // infinity jika tidak ada rute yang memenuhi anggaran atau batas label
+    // tercapai lebih dulu (truncated)
+    double run(const CSRGraph& csr, const vector<double>& primaryWeights,
+               const vector<double>& resourceWeights, uint32_t startId, uint32_t endId,
+               double budget, size_t maxLabels, vector<uint32_t>& path, double& resourceUsed,
+               size_t& settled, bool& truncated) {
+        path.clear();
+        resourceUsed = 0;
+        settled = 0;
+        truncated = false;
+
+        uint32_t nodeCount = csr.getNodeCount();
+        if (minResource.size() != nodeCount) {
+            minResource.assign(nodeCount, numeric_limits<double>::infinity());
+        } else {
+            for (uint32_t node : touchedNodes) {
+                minResource[node] = numeric_limits<double>::infinity();
+            }
+        }
+        touchedNodes.clear();
+        arena.clear();
+
+        const double infinity = numeric_limits<double>::infinity();
+        const double* primary = primaryWeights.data();
+        const double* resource = resourceWeights.data();
+        // Toleransi kecil agar rute yang tepat sama dengan anggaran tidak
+        // terbuang karena galat pembulatan penjumlahan
+        budget += 1e-9 * max(1.0, budget);
+        reverseDistances(csr, resource, endId, resourceBound);
+        if (resourceBound[startId] > budget) return infinity;
+        reverseDistances(csr, primary, endId, primaryBound);
+
+        priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry>> queue;
+        arena.push_back({ 0, 0, startId, NO_LABEL });
+        queue.push({ primaryBound[startId], 0, 0 });
+
+        while (!queue.empty()) {
+            uint32_t id = queue.top().label;
+            queue.pop();
+
+            Label label = arena[id];
+            if (label.resource >= minResource[label.node]) continue;
+            if (minResource[label.node] == infinity) touchedNodes.push_back(label.node);
+            minResource[label.node] = label.resource;
+            ++settled;
+
+            if (label.node == endId) {
+                for (uint32_t at = id; at != NO_LABEL; at = arena[at].parent) {
+                    path.push_back(arena[at].node);
+                }
+                reverse(path.begin(), path.end());
+                resourceUsed = label.resource;
+                return label.primary;
+            }
+
+            for (uint32_t e = csr.edgeBegin(label.node); e < csr.edgeEnd(label.node); ++e) {
+                uint32_t next = csr.getTarget(e);
+                double nextResource = label.resource + resource[e];
+                if (nextResource + resourceBound[next] > budget || nextResource >= minResource[next]) continue;
+
+                if (arena.size() >= maxLabels) {
+                    truncated = true;
+                    return infinity;
+                }
+                double nextPrimary = label.primary + primary[e];
+                queue.push({ nextPrimary + primaryBound[next], nextResource, static_cast<uint32_t>(arena.size()) });
+                arena.push_back({ nextPrimary, nextResource, next, id });
+            }
+        }
+        return infinity;
+    }
+};
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef CONTRACTION_HIERARCHY_H
+#define CONTRACTION_HIERARCHY_H
+
+#include "CSRGraph.h"
+#include "SearchWorkspace.h"
+#include <vector>
+#include <queue>
+#include <functional>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Contraction Hierarchies untuk satu kolom bobot. Node dikontraksi satu per
+// satu (urutan berdasarkan edge difference), shortcut ditambahkan bila tidak
+// ada jalur saksi (witness) yang sama murahnya. Query menggunakan Dijkstra
+// dua arah yang hanya naik ke node dengan rank lebih tinggi.
+class ContractionHierarchy {
+public:
+    struct Arc {
+        uint32_t node;      // tetangga dengan rank lebih tinggi
+        double weight;
+        uint32_t middle;    // node yang dilewati shortcut, INVALID_NODE jika edge asli
+    };
+
+private:
+    // Batas node pada witness search: kecil saat hanya mensimulasikan
+    // kontraksi untuk menghitung prioritas, lebih besar saat kontraksi nyata
+    static constexpr size_t SIMULATION_SETTLE_LIMIT = 50;
+    static constexpr size_t WITNESS_SETTLE_LIMIT = 500;
+
+    unsigned long long version;
+    uint32_t nodeCount;
+    size_t shortcutCount;
+    vector<uint32_t> rank;
+
+    // forwardArcs[v]: v -> x dengan rank x > rank v
+    // backwardArcs[v]: u -> v dengan rank u > rank v (node = u)
+    vector<uint32_t> forwardOffsets;
+    vector<Arc> forwardArcs;
+    vector<uint32_t> backwardOffsets;
+    vector<Arc> backwardArcs;
+
+    // Struktur sementara selama preprocessing
+    struct Builder {
+        vector<vector<Arc>> out;
+        vector<vector<Arc>> in;
+        vector<char> contracted;
+        vector<uint32_t> contractedNeighbors;
+        vector<uint32_t> level;
+        vector<char> isTarget;
+        SearchWorkspace witness;
+
+        static void addOrImprove(vector<Arc>& arcs, uint32_t node, double weight, uint32_t middle) {
+            for (Arc& arc : arcs) {
+                if (arc.node == node) {
+                    if (weight < arc.weight) {
+                        arc.weight = weight;
+                        arc.middle = middle;
+                    }
+                    return;
+                }
+            }
+            arcs.push_back({ node, weight, middle });
+        }
+
+        static void removeArc(vector<Arc>& arcs, uint32_t node) {
+            for (size_t i = 0; i < arcs.size(); ++i) {
+                if (arcs[i].node == node) {
+                    arcs[i] = arcs.back();
+                    arcs.pop_back();
+                    return;
+                }
+            }
+        }
+
+        // Dijkstra lokal dari source yang tidak melewati node `excluded`.
+        // Berhenti setelah semua target (isTarget) diselesaikan.
+        void witnessSearch(uint32_t source, uint32_t excluded, double maxCost,
+                           size_t targetCount, size_t settleLimit) {
+            witness.reset(out.size());
+            witness.improve(source, 0, CSRGraph::INVALID_NODE);
+            size_t settled = 0;
+
+            while (!witness.heap.empty() && settled < settleLimit && targetCount > 0) {
+                if (witness.heap.topKey() > maxCost) break;
+                uint32_t u = witness.heap.pop();
+                ++settled;
+                if (isTarget[u]) --targetCount;
+
+                for (const Arc& arc : out[u]) {
+                    if (arc.node == excluded) continue;
+                    witness.improve(arc.node, witness.cost[u] + arc.weight, u);
+                }
+            }
+        }
+
+        // Mengembalikan jumlah shortcut yang dibutuhkan untuk mengontraksi v.
+        // Jika simulate == false, shortcut benar-benar ditambahkan.
+        size_t contract(uint32_t v, bool simulate) {
+            size_t shortcuts = 0;
+            double maxOut = 0;
+            for (const Arc& arc : out[v]) maxOut = max(maxOut, arc.weight);
+
+            for (const Arc& arc : out[v]) isTarget[arc.node] = 1;
+
+            vector<Arc> incoming = in[v];
+            for (const Arc& inArc : incoming) {
+                uint32_t u = inArc.node;
+                size_t targetCount = out[v].size();  // source ikut di-pop jika termasuk target
+                witnessSearch(u, v, inArc.weight + maxOut, targetCount,
+                              simulate ? SIMULATION_SETTLE_LIMIT : WITNESS_SETTLE_LIMIT);
+
+                for (const Arc& outArc : out[v]) {
+                    uint32_t x = outArc.node;
+                    if (x == u) continue;
+
+                    double viaV = inArc.weight + outArc.weight;
+                    if (witness.cost[x] <= viaV) continue;
+
+                    ++shortcuts;
+                    if (!simulate) {
+                        addOrImprove(out[u], x, viaV, v);
+                        addOrImprove(in[x], u, viaV, v);
+                    }
+                }
+            }
+
+            for (const Arc& arc : out[v]) isTarget[arc.node] = 0;
+            return shortcuts;
+        }
+
+        // Edge difference ditambah jumlah tetangga yang sudah dikontraksi dan
+        // level hierarki, agar kontraksi tersebar merata di seluruh graf
+        long long priority(uint32_t v) {
+            long long shortcuts = static_cast<long long>(contract(v, true));
+            long long removed = static_cast<long long>(in[v].size() + out[v].size());
+            return 2 * (shortcuts - removed) + contractedNeighbors[v] + level[v];
+        }
+    };
+
+    static void buildStatic(const vector<vector<Arc>>& lists, vector<uint32_t>& offsets, vector<Arc>& arcs) {
+        offsets.assign(lists.size() + 1, 0);
+        for (size_t v = 0; v < lists.size(); ++v) {
+            offsets[v + 1] = offsets[v] + static_cast<uint32_t>(lists[v].size());
+        }
+        arcs.clear();
+        arcs.reserve(offsets.back());
+        for (const auto& list : lists) {
+            arcs.insert(arcs.end(), list.begin(), list.end());
+        }
+    }
+
+    const Arc* findArc(uint32_t from, uint32_t to) const {
+        if (rank[from] < rank[to]) {
+            for (uint32_t i = forwardOffsets[from]; i < forwardOffsets[from + 1]; ++i) {
+                if (forwardArcs[i].node == to) return &forwardArcs[i];
+            }
+        } else {
+            for (uint32_t i = backwardOffsets[to]; i < backwardOffsets[to + 1]; ++i) {
+                if (backwardArcs[i].node == from) return &backwardArcs[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Membongkar shortcut menjadi urutan node asli (tanpa node awal)
+    void unpack(uint32_t from, uint32_t to, vector<uint32_t>& path) const {
+        const Arc* arc = findArc(from, to);
+        if (arc == nullptr || arc->middle == CSRGraph::INVALID_NODE) {
+            path.push_back(to);
+            return;
+        }
+        unpack(from, arc->middle, path);
+        unpack(arc->middle, to, path);
+    }
+
+public:
+    ContractionHierarchy(const CSRGraph& csr, const vector<double>& weights)
+        : version(csr.getVersion()), nodeCount(csr.getNodeCount()), shortcutCount(0) {
+        Builder builder;
+        builder.out.resize(nodeCount);
+        builder.in.resize(nodeCount);
+        builder.contracted.assign(nodeCount, 0);
+        builder.contractedNeighbors.assign(nodeCount, 0);
+        builder.level.assign(nodeCount, 0);
+        builder.isTarget.assign(nodeCount, 0);
+
+        for (uint32_t u = 0; u < nodeCount; ++u) {
+            for (uint32_t e = csr.edgeBegin(u); e < csr.edgeEnd(u); ++e) {
+                uint32_t v = csr.getTarget(e);
+                if (u == v) continue;
+                Builder::addOrImprove(builder.out[u], v, weights[e], CSRGraph::INVALID_NODE);
+                Builder::addOrImprove(builder.in[v], u, weights[e], CSRGraph::INVALID_NODE);
+            }
+        }
+
+        typedef pair<long long, uint32_t> QueueEntry;
+        priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry>> queue;
+        vector<long long> currentPriority(nodeCount);
+        for (uint32_t v = 0; v < nodeCount; ++v) {
+            currentPriority[v] = builder.priority(v);
+            queue.push({ currentPriority[v], v });
+        }
+
+        vector<vector<Arc>> upward(nodeCount), downward(nodeCount);
+        rank.assign(nodeCount, 0);
+        uint32_t nextRank = 0;
+
+        while (!queue.empty()) {
+            QueueEntry top = queue.top();
+            queue.pop();
+            uint32_t v = top.second;
+            if (builder.contracted[v] || top.first != currentPriority[v]) continue;
+
+            // Lazy update: prioritas dihitung ulang, kembalikan jika tidak lagi minimum
+            long long current = builder.priority(v);
+            if (!queue.empty() && current > queue.top().first) {
+                currentPriority[v] = current;
+                queue.push({ current, v });
+                continue;
+            }
+
+            shortcutCount += builder.contract(v, false);
+
+            upward[v] = builder.out[v];
+            downward[v] = builder.in[v];
+            rank[v] = nextRank++;
+            builder.contracted[v] = 1;
+
+            for (const Arc& arc : builder.out[v]) {
+                Builder::removeArc(builder.in[arc.node], v);
+                ++builder.contractedNeighbors[arc.node];
+            }
+            for (const Arc& arc : builder.in[v]) {
+                Builder::removeArc(builder.out[arc.node], v);
+                ++builder.contractedNeighbors[arc.node];
+            }
+
+            // Prioritas tetangga berubah setelah v dikontraksi
+            vector<uint32_t> neighbors;
+            for (const Arc& arc : builder.out[v]) neighbors.push_back(arc.node);
+            for (const Arc& arc : builder.in[v]) neighbors.push_back(arc.node);
+            sort(neighbors.begin(), neighbors.end());
+            neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
+            for (uint32_t neighbor : neighbors) {
+                builder.level[neighbor] = max(builder.level[neighbor], builder.level[v] + 1);
+                currentPriority[neighbor] = builder.priority(neighbor);
+                queue.push({ currentPriority[neighbor], neighbor });
+            }
+
+            vector<Arc>().swap(builder.out[v]);
+            vector<Arc>().swap(builder.in[v]);
+        }
+
+        buildStatic(upward, forwardOffsets, forwardArcs);
+        buildStatic(downward, backwardOffsets, backwardArcs);
+    }
+
+    unsigned long long getVersion() const { return version; }
+    size_t getShortcutCount() const { return shortcutCount; }
+
+    // Query dua arah naik-hierarki. Mengisi path (ID node asli, sudah di-unpack)
+    // dan mengembalikan biaya; infinity jika tidak ada rute.
+    double query(uint32_t startId, uint32_t endId, SearchWorkspace& fw, SearchWorkspace& bw,
+                 vector<uint32_t>& path, size_t& settled) const {
+        fw.reset(nodeCount);
+        bw.reset(nodeCount);
+        fw.improve(startId, 0, CSRGraph::INVALID_NODE);
+        bw.improve(endId, 0, CSRGraph::INVALID_NODE);
+
+        double best = startId == endId ? 0 : numeric_limits<double>::infinity();
+        uint32_t meeting = startId == endId ? startId : CSRGraph::INVALID_NODE;
+        settled = 0;
+
+        // Setiap arah boleh berhenti sendiri begitu key minimumnya >= best
+        while (true) {
+            bool forwardActive = !fw.heap.empty() && fw.heap.topKey() < best;
+            bool backwardActive = !bw.heap.empty() && bw.heap.topKey() < best;
+            if (!forwardActive && !backwardActive) break;
+
+            bool forward = forwardActive && (!backwardActive || fw.heap.topKey() <= bw.heap.topKey());
+            SearchWorkspace& self = forward ? fw : bw;
+            SearchWorkspace& other = forward ? bw : fw;
+            const vector<uint32_t>& offsets = forward ? forwardOffsets : backwardOffsets;
+            const vector<Arc>& arcs = forward ? forwardArcs : backwardArcs;
+            const vector<uint32_t>& oppositeOffsets = forward ? backwardOffsets : forwardOffsets;
+            const vector<Arc>& oppositeArcs = forward ? backwardArcs : forwardArcs;
+
+            uint32_t u = self.heap.pop();
+            ++settled;
+
+            // Stall-on-demand: jika u bisa dicapai lebih murah lewat node yang
+            // rank-nya lebih tinggi, jalur lewat u tidak mungkin optimal
+            bool stalled = false;
+            for (uint32_t i = oppositeOffsets[u]; i < oppositeOffsets[u + 1]; ++i) {
+                if (self.cost[oppositeArcs[i].node] + oppositeArcs[i].weight < self.cost[u]) {
+                    stalled = true;
+                    break;
+                }
+            }
+            if (stalled) continue;
+
+            for (uint32_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+                const Arc& arc = arcs[i];
+                double candidate = self.cost[u] + arc.weight;
+                self.improve(arc.node, candidate, u);
+                if (candidate + other.cost[arc.node] < best) {
+                    best = candidate + other.cost[arc.node];
+                    meeting = arc.node;
+                }
+            }
+        }
+
+        path.clear();
+        if (meeting == CSRGraph::INVALID_NODE) {
+            return numeric_limits<double>::infinity();
+        }
+
+        vector<uint32_t> upPath;
+        for (uint32_t id = meeting; id != CSRGraph::INVALID_NODE; id = fw.previous[id]) {
+            upPath.push_back(id);
+        }
+        reverse(upPath.begin(), upPath.end());
+        for (uint32_t id = bw.previous[meeting]; id != CSRGraph::INVALID_NODE; id = bw.previous[id]) {
+            upPath.push_back(id);
+        }
+
+        path.push_back(upPath.front());
+        for (size_t i = 0; i + 1 < upPath.size(); ++i) {
+            unpack(upPath[i], upPath[i + 1], path);
+        }
+        return best;
+    }
+};
+
+#endif
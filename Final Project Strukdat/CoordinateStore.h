@@ -0,0 +1,170 @@
+#ifndef COORDINATE_STORE_H
+#define COORDINATE_STORE_H
+
+#include "Location.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+// Versi vektor dari squaredLength (Location.h). Intrinsik mul/add juga
+// bisa digabung kompiler menjadi FMA, jadi bentuk FMA ditulis eksplisit
+// di sini seperti pada versi skalarnya.
+#if defined(__AVX__)
+inline __m256d squaredLengthAvx(__m256d dx, __m256d dy) {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(dx, dx, _mm256_mul_pd(dy, dy));
+#else
+    return _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+#endif
+}
+#endif
+
+#if defined(__SSE2__)
+inline __m128d squaredLengthSse(__m128d dx, __m128d dy) {
+#if defined(__FMA__)
+    return _mm_fmadd_pd(dx, dx, _mm_mul_pd(dy, dy));
+#else
+    return _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+#endif
+}
+#endif
+
+#if defined(__AVX2__)
+// Gather bermask dengan nilai awal nol; versi tanpa mask membuat GCC
+// memperingatkan register tujuan yang belum diinisialisasi
+inline __m256d gatherAvx2(const double* base, __m128i ids) {
+    __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, ids, all, 8);
+}
+#endif
+
+// Kernel jarak Euclid dari satu titik (x, y) ke sederet titik dalam dua
+// kolom koordinat. Seperti kernel skor preferensi: AVX (4 double) jika
+// dikompilasi dengan -mavx/-march=native, SSE2 (2 double) pada x86-64 biasa,
+// dan loop skalar untuk sisanya. Semua jalur memakai squaredLength yang
+// sama dengan Location::distanceTo, dan sqrt SIMD dibulatkan dengan benar,
+// jadi pada x86 hasilnya identik bit per bit di semua tingkat optimasi.
+inline void computeDistancesScalar(double x, double y, const double* xs, const double* ys,
+                                   size_t count, double* out) {
+    for (size_t i = 0; i < count; ++i) {
+        double dx = x - xs[i];
+        double dy = y - ys[i];
+        out[i] = sqrt(squaredLength(dx, dy));
+    }
+}
+
+inline void computeDistances(double x, double y, const double* xs, const double* ys,
+                             size_t count, double* out) {
+    size_t i = 0;
+#if defined(__AVX__)
+    __m256d px = _mm256_set1_pd(x);
+    __m256d py = _mm256_set1_pd(y);
+    for (; i + 4 <= count; i += 4) {
+        __m256d dx = _mm256_sub_pd(px, _mm256_loadu_pd(xs + i));
+        __m256d dy = _mm256_sub_pd(py, _mm256_loadu_pd(ys + i));
+        __m256d squared = squaredLengthAvx(dx, dy);
+        _mm256_storeu_pd(out + i, _mm256_sqrt_pd(squared));
+    }
+#elif defined(__SSE2__)
+    __m128d px = _mm_set1_pd(x);
+    __m128d py = _mm_set1_pd(y);
+    for (; i + 2 <= count; i += 2) {
+        __m128d dx = _mm_sub_pd(px, _mm_loadu_pd(xs + i));
+        __m128d dy = _mm_sub_pd(py, _mm_loadu_pd(ys + i));
+        __m128d squared = squaredLengthSse(dx, dy);
+        _mm_storeu_pd(out + i, _mm_sqrt_pd(squared));
+    }
+#endif
+    computeDistancesScalar(x, y, xs + i, ys + i, count - i, out + i);
+}
+
+// Jarak antara pasangan titik from[i] -> to[i]. Dengan AVX2 koordinat
+// diambil lewat gather; tanpa AVX2 pengambilannya skalar dan hanya
+// aritmetikanya yang memakai SSE2.
+inline void computePairDistancesScalar(const double* xs, const double* ys, const uint32_t* from,
+                                       const uint32_t* to, size_t count, double* out) {
+    for (size_t i = 0; i < count; ++i) {
+        double dx = xs[from[i]] - xs[to[i]];
+        double dy = ys[from[i]] - ys[to[i]];
+        out[i] = sqrt(squaredLength(dx, dy));
+    }
+}
+
+inline void computePairDistances(const double* xs, const double* ys, const uint32_t* from,
+                                 const uint32_t* to, size_t count, double* out) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= count; i += 4) {
+        __m128i fromIds = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+        __m128i toIds = _mm_loadu_si128(reinterpret_cast<const __m128i*>(to + i));
+        __m256d dx = _mm256_sub_pd(gatherAvx2(xs, fromIds), gatherAvx2(xs, toIds));
+        __m256d dy = _mm256_sub_pd(gatherAvx2(ys, fromIds), gatherAvx2(ys, toIds));
+        __m256d squared = squaredLengthAvx(dx, dy);
+        _mm256_storeu_pd(out + i, _mm256_sqrt_pd(squared));
+    }
+#elif defined(__SSE2__)
+    for (; i + 2 <= count; i += 2) {
+        __m128d dx = _mm_sub_pd(_mm_set_pd(xs[from[i + 1]], xs[from[i]]),
+                                _mm_set_pd(xs[to[i + 1]], xs[to[i]]));
+        __m128d dy = _mm_sub_pd(_mm_set_pd(ys[from[i + 1]], ys[from[i]]),
+                                _mm_set_pd(ys[to[i + 1]], ys[to[i]]));
+        __m128d squared = squaredLengthSse(dx, dy);
+        _mm_storeu_pd(out + i, _mm_sqrt_pd(squared));
+    }
+#endif
+    computePairDistancesScalar(xs, ys, from + i, to + i, count - i, out + i);
+}
+
+// Koordinat kota dalam bentuk kolom (semua x, lalu semua y) yang diindeks
+// dengan ID padat, sehingga jarak ke banyak kota bisa dihitung per blok
+// tanpa menyentuh objek Location (vtable dan string nama) satu per satu.
+class CoordinateStore {
+private:
+    vector<double> xs;
+    vector<double> ys;
+
+public:
+    CoordinateStore() {}
+    explicit CoordinateStore(size_t count) : xs(count), ys(count) {}
+
+    size_t size() const { return xs.size(); }
+    double getX(uint32_t id) const { return xs[id]; }
+    double getY(uint32_t id) const { return ys[id]; }
+    const vector<double>& getXs() const { return xs; }
+    const vector<double>& getYs() const { return ys; }
+
+    void set(uint32_t id, double x, double y) {
+        xs[id] = x;
+        ys[id] = y;
+    }
+
+    // Salinan dengan titik ke-i = titik order[i]; dipakai agar titik yang
+    // dibaca bersamaan (misalnya satu sel grid) bersebelahan di memori
+    CoordinateStore permuted(const vector<uint32_t>& order) const {
+        CoordinateStore result(order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            result.xs[i] = xs[order[i]];
+            result.ys[i] = ys[order[i]];
+        }
+        return result;
+    }
+
+    // out[i - first] = jarak (x, y) ke titik i, untuk i di [first, last)
+    void distancesFrom(double x, double y, size_t first, size_t last, double* out) const {
+        computeDistances(x, y, xs.data() + first, ys.data() + first, last - first, out);
+    }
+
+    // out[i] = jarak titik from[i] ke titik to[i]
+    void distancesBetween(const uint32_t* from, const uint32_t* to, size_t count, double* out) const {
+        computePairDistances(xs.data(), ys.data(), from, to, count, out);
+    }
+};
+
+#endif
@@ -0,0 +1,520 @@
+#ifndef CUSTOMIZABLE_HIERARCHY_H
+#define CUSTOMIZABLE_HIERARCHY_H
+
+#include "CSRGraph.h"
+#include "ThreadPool.h"
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Customizable Contraction Hierarchies (Dibbelt, Strasser & Wagner).
+// Preprocessing hanya bergantung pada topologi: urutan kontraksi diambil
+// dari nested dissection berdasarkan koordinat lokasi, lalu graf (dianggap
+// tak berarah) dilengkapi menjadi chordal sehingga setiap pasangan tetangga
+// yang lebih tinggi dari sebuah node saling terhubung. Tahap customization
+// mengisi bobot arc untuk satu metrik (misalnya satu setelan preferensi)
+// dengan memproses segitiga bawah setiap arc, tanpa witness search, jadi
+// mengganti bobot preferensi jauh lebih murah daripada membangun CH baru.
+//
+// Di dalam struktur ini node diberi nomor menurut rank (0 = dikontraksi
+// pertama); order[rank] mengembalikan ID node CSR.
+class CustomizableHierarchy {
+public:
+    // Bobot hasil customization untuk satu metrik. up[a] adalah bobot arc a
+    // dari node rendah ke node tinggi, down[a] arah sebaliknya; middle
+    // menyimpan rank node yang dilewati shortcut (INVALID_NODE jika edge asli).
+    struct Metric {
+        unsigned long long version;
+        vector<double> up;
+        vector<double> down;
+        vector<uint32_t> upMiddle;
+        vector<uint32_t> downMiddle;
+
+        Metric() : version(0) {}
+    };
+
+    // Buffer query yang dipakai ulang. Hanya node pada jalur elimination tree
+    // yang disentuh, dan dikembalikan ke infinity setelah query.
+    struct Workspace {
+        vector<double> forward;
+        vector<double> backward;
+        vector<uint32_t> forwardPrevious;
+        vector<uint32_t> backwardPrevious;
+
+        void reset(size_t nodeCount) {
+            if (forward.size() == nodeCount) return;
+            forward.assign(nodeCount, numeric_limits<double>::infinity());
+            backward.assign(nodeCount, numeric_limits<double>::infinity());
+            forwardPrevious.assign(nodeCount, CSRGraph::INVALID_NODE);
+            backwardPrevious.assign(nodeCount, CSRGraph::INVALID_NODE);
+        }
+    };
+
+private:
+    // Sel dengan node sebanyak ini atau kurang tidak dibelah lagi
+    static constexpr size_t LEAF_CELL_SIZE = 8;
+    // Node dengan arc bawah sebanyak ini atau lebih dikerjakan beberapa thread
+    static constexpr uint32_t PARALLEL_LOWER_ARCS = 512;
+    // Level elimination tree dengan node sebanyak ini atau lebih dibagi per node
+    static constexpr size_t PARALLEL_LEVEL_NODES = 64;
+
+    unsigned long long topologyVersion;
+    uint32_t nodeCount;
+    vector<uint32_t> rank;    // ID node -> rank
+    vector<uint32_t> order;   // rank -> ID node
+    vector<uint32_t> parent;  // elimination tree (rank), INVALID_NODE untuk akar
+
+    // Node dikelompokkan menurut tinggi di elimination tree. Node setinggi
+    // sama tidak saling bergantung saat customization (arc bawah sebuah node
+    // selalu milik keturunannya), jadi bisa dikerjakan paralel.
+    vector<uint32_t> levelOffsets;
+    vector<uint32_t> levelNodes;
+
+    // Arc ke tetangga yang rank-nya lebih tinggi, terurut naik
+    vector<uint32_t> arcOffsets;
+    vector<uint32_t> arcHeads;
+
+    // Arc dari tetangga yang lebih rendah: untuk node x, lowerArcs berisi
+    // indeks arc (r, x) dan lowerSources node r-nya; dipakai customization
+    vector<uint32_t> lowerOffsets;
+    vector<uint32_t> lowerArcs;
+    vector<uint32_t> lowerSources;
+
+    // Edge CSR e dipetakan ke arc edgeArc[e] dengan arah edgeUpward[e]
+    vector<uint32_t> edgeArc;
+    vector<char> edgeUpward;
+
+    // Nested dissection: kedua belahan diurutkan lebih dulu, separator
+    // (node satu belahan yang bertetangga dengan belahan lain) paling akhir
+    // sehingga mendapat rank tertinggi.
+    void dissect(vector<uint32_t>& cell, const CSRGraph& csr,
+                 const vector<vector<uint32_t>>& neighbors, vector<uint32_t>& side,
+                 uint32_t& nextTag) {
+        if (cell.size() <= LEAF_CELL_SIZE) {
+            order.insert(order.end(), cell.begin(), cell.end());
+            return;
+        }
+
+        double minX = numeric_limits<double>::infinity(), maxX = -minX;
+        double minY = minX, maxY = -minX;
+        for (uint32_t v : cell) {
+            minX = min(minX, csr.getX(v));
+            maxX = max(maxX, csr.getX(v));
+            minY = min(minY, csr.getY(v));
+            maxY = max(maxY, csr.getY(v));
+        }
+        bool byX = maxX - minX >= maxY - minY;
+        auto coordinate = [&csr, byX](uint32_t v) { return byX ? csr.getX(v) : csr.getY(v); };
+
+        size_t half = cell.size() / 2;
+        nth_element(cell.begin(), cell.begin() + half, cell.end(),
+            [&coordinate](uint32_t a, uint32_t b) { return coordinate(a) < coordinate(b); });
+
+        uint32_t leftTag = nextTag++;
+        uint32_t rightTag = nextTag++;
+        for (size_t i = 0; i < cell.size(); ++i) {
+            side[cell[i]] = i < half ? leftTag : rightTag;
+        }
+
+        // Separator diambil dari sisi yang batasnya lebih kecil
+        size_t leftBoundary = 0, rightBoundary = 0;
+        for (size_t i = 0; i < cell.size(); ++i) {
+            uint32_t opposite = i < half ? rightTag : leftTag;
+            for (uint32_t u : neighbors[cell[i]]) {
+                if (side[u] == opposite) {
+                    ++(i < half ? leftBoundary : rightBoundary);
+                    break;
+                }
+            }
+        }
+        bool separateLeft = leftBoundary <= rightBoundary;
+        uint32_t separatorTag = separateLeft ? leftTag : rightTag;
+        uint32_t opposite = separateLeft ? rightTag : leftTag;
+
+        vector<uint32_t> left, right, separator;
+        for (size_t i = 0; i < cell.size(); ++i) {
+            uint32_t v = cell[i];
+            bool isSeparator = false;
+            if (side[v] == separatorTag) {
+                for (uint32_t u : neighbors[v]) {
+                    if (side[u] == opposite) {
+                        isSeparator = true;
+                        break;
+                    }
+                }
+            }
+            if (isSeparator) separator.push_back(v);
+            else if (i < half) left.push_back(v);
+            else right.push_back(v);
+        }
+        vector<uint32_t>().swap(cell);
+
+        dissect(left, csr, neighbors, side, nextTag);
+        dissect(right, csr, neighbors, side, nextTag);
+        order.insert(order.end(), separator.begin(), separator.end());
+    }
+
+    struct ArcValues {
+        double* up;
+        double* down;
+        uint32_t* upMiddle;
+        uint32_t* downMiddle;
+    };
+
+    void mapUpperArcs(uint32_t x, vector<uint32_t>& arcTo) const {
+        for (uint32_t a = arcOffsets[x]; a < arcOffsets[x + 1]; ++a) {
+            arcTo[arcHeads[a]] = a;
+        }
+    }
+
+    // Memperbaiki arc (x, y) lewat arc bawah lowerArcs[first, last) milik x.
+    // arcTo[y] adalah indeks arc (x, y); hasil ditulis ke out[arcTo[y] - base].
+    void relaxLowerTriangles(uint32_t first, uint32_t last, const vector<uint32_t>& arcTo,
+                             const Metric& metric, ArcValues out, uint32_t base) const {
+        const double* up = metric.up.data();
+        const double* down = metric.down.data();
+        for (uint32_t l = first; l < last; ++l) {
+            uint32_t i = lowerArcs[l];  // arc (r, x)
+            uint32_t r = lowerSources[l];
+            double toX = up[i];         // r -> x
+            double fromX = down[i];     // x -> r
+
+            // Tetangga atas r setelah x pasti tetangga atas x (chordal)
+            for (uint32_t j = i + 1; j < arcOffsets[r + 1]; ++j) {
+                uint32_t target = arcTo[arcHeads[j]] - base;
+                double viaUp = fromX + up[j];    // x -> r -> y
+                double viaDown = down[j] + toX;  // y -> r -> x
+                if (viaUp < out.up[target]) {
+                    out.up[target] = viaUp;
+                    out.upMiddle[target] = r;
+                }
+                if (viaDown < out.down[target]) {
+                    out.down[target] = viaDown;
+                    out.downMiddle[target] = r;
+                }
+            }
+        }
+    }
+
+    // Arc bawah node x yang besar dibagi ke beberapa thread, masing-masing
+    // menulis ke salinan arc x sendiri. Salinan digabung urut potongan dengan
+    // perbandingan ketat, sehingga middle yang terpilih sama seperti serial.
+    void relaxNodeParallel(uint32_t x, const vector<uint32_t>& arcTo, const Metric& metric,
+                           ArcValues values, ThreadPool& pool) const {
+        const double infinity = numeric_limits<double>::infinity();
+        uint32_t base = arcOffsets[x];
+        uint32_t degree = arcOffsets[x + 1] - base;
+        uint32_t first = lowerOffsets[x], last = lowerOffsets[x + 1];
+        size_t chunks = min<size_t>(pool.size(), (last - first) / (PARALLEL_LOWER_ARCS / 2));
+
+        vector<double> ups(chunks * degree, infinity), downs(chunks * degree, infinity);
+        vector<uint32_t> upMiddles(chunks * degree, CSRGraph::INVALID_NODE);
+        vector<uint32_t> downMiddles(chunks * degree, CSRGraph::INVALID_NODE);
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            uint32_t begin = first + static_cast<uint32_t>((last - first) * chunk / chunks);
+            uint32_t end = first + static_cast<uint32_t>((last - first) * (chunk + 1) / chunks);
+            ArcValues local = { &ups[chunk * degree], &downs[chunk * degree],
+                                &upMiddles[chunk * degree], &downMiddles[chunk * degree] };
+            pool.submit([this, &arcTo, &metric, local, begin, end, base]() {
+                relaxLowerTriangles(begin, end, arcTo, metric, local, base);
+            });
+        }
+        pool.wait();
+
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            for (uint32_t k = 0; k < degree; ++k) {
+                size_t slot = chunk * degree + k;
+                if (ups[slot] < values.up[base + k]) {
+                    values.up[base + k] = ups[slot];
+                    values.upMiddle[base + k] = upMiddles[slot];
+                }
+                if (downs[slot] < values.down[base + k]) {
+                    values.down[base + k] = downs[slot];
+                    values.downMiddle[base + k] = downMiddles[slot];
+                }
+            }
+        }
+    }
+
+    uint32_t findArc(uint32_t low, uint32_t high) const {
+        auto first = arcHeads.begin() + arcOffsets[low];
+        auto last = arcHeads.begin() + arcOffsets[low + 1];
+        auto it = lower_bound(first, last, high);
+        return (it != last && *it == high) ? static_cast<uint32_t>(it - arcHeads.begin()) : CSRGraph::INVALID_NODE;
+    }
+
+    // Membongkar arc from -> to (rank) menjadi ID node asli (tanpa node awal)
+    void unpack(const Metric& metric, uint32_t from, uint32_t to, vector<uint32_t>& path) const {
+        bool upward = from < to;
+        uint32_t arc = upward ? findArc(from, to) : findArc(to, from);
+        uint32_t middle = upward ? metric.upMiddle[arc] : metric.downMiddle[arc];
+        if (middle == CSRGraph::INVALID_NODE) {
+            path.push_back(order[to]);
+            return;
+        }
+        unpack(metric, from, middle, path);
+        unpack(metric, middle, to, path);
+    }
+
+public:
+    explicit CustomizableHierarchy(const CSRGraph& csr)
+        : topologyVersion(csr.getTopologyVersion()), nodeCount(csr.getNodeCount()) {
+        // Tetangga tak berarah tanpa loop dan duplikat
+        vector<vector<uint32_t>> neighbors(nodeCount);
+        for (uint32_t u = 0; u < nodeCount; ++u) {
+            for (uint32_t e = csr.edgeBegin(u); e < csr.edgeEnd(u); ++e) {
+                uint32_t v = csr.getTarget(e);
+                if (u == v) continue;
+                neighbors[u].push_back(v);
+                neighbors[v].push_back(u);
+            }
+        }
+        for (vector<uint32_t>& list : neighbors) {
+            sort(list.begin(), list.end());
+            list.erase(unique(list.begin(), list.end()), list.end());
+        }
+
+        vector<uint32_t> cell(nodeCount);
+        for (uint32_t v = 0; v < nodeCount; ++v) cell[v] = v;
+        vector<uint32_t> side(nodeCount, 0);
+        uint32_t nextTag = 1;
+        order.reserve(nodeCount);
+        dissect(cell, csr, neighbors, side, nextTag);
+
+        rank.assign(nodeCount, 0);
+        for (uint32_t r = 0; r < nodeCount; ++r) rank[order[r]] = r;
+
+        // Chordal completion: tetangga atas node r menjadi clique. Cukup
+        // diteruskan ke tetangga atas terendahnya (parent di elimination tree),
+        // yang nanti meneruskannya lagi saat gilirannya tiba.
+        vector<vector<uint32_t>> upper(nodeCount);
+        for (uint32_t v = 0; v < nodeCount; ++v) {
+            for (uint32_t u : neighbors[v]) {
+                if (rank[u] > rank[v]) upper[rank[v]].push_back(rank[u]);
+            }
+            vector<uint32_t>().swap(neighbors[v]);
+        }
+
+        parent.assign(nodeCount, CSRGraph::INVALID_NODE);
+        arcOffsets.assign(nodeCount + 1, 0);
+        for (uint32_t r = 0; r < nodeCount; ++r) {
+            vector<uint32_t>& list = upper[r];
+            sort(list.begin(), list.end());
+            list.erase(unique(list.begin(), list.end()), list.end());
+            arcOffsets[r + 1] = arcOffsets[r] + static_cast<uint32_t>(list.size());
+            if (list.empty()) continue;
+
+            parent[r] = list[0];
+            upper[list[0]].insert(upper[list[0]].end(), list.begin() + 1, list.end());
+        }
+
+        vector<uint32_t> height(nodeCount, 0);
+        uint32_t maxHeight = 0;
+        for (uint32_t r = 0; r < nodeCount; ++r) {
+            if (parent[r] != CSRGraph::INVALID_NODE) height[parent[r]] = max(height[parent[r]], height[r] + 1);
+            maxHeight = max(maxHeight, height[r]);
+        }
+        levelOffsets.assign(maxHeight + 2, 0);
+        for (uint32_t r = 0; r < nodeCount; ++r) ++levelOffsets[height[r] + 1];
+        for (uint32_t level = 0; level <= maxHeight; ++level) levelOffsets[level + 1] += levelOffsets[level];
+        levelNodes.resize(nodeCount);
+        vector<uint32_t> levelCursor(levelOffsets.begin(), levelOffsets.end() - 1);
+        for (uint32_t r = 0; r < nodeCount; ++r) levelNodes[levelCursor[height[r]]++] = r;
+
+        arcHeads.reserve(arcOffsets[nodeCount]);
+        for (uint32_t r = 0; r < nodeCount; ++r) {
+            arcHeads.insert(arcHeads.end(), upper[r].begin(), upper[r].end());
+            vector<uint32_t>().swap(upper[r]);
+        }
+
+        lowerOffsets.assign(nodeCount + 1, 0);
+        for (uint32_t head : arcHeads) ++lowerOffsets[head + 1];
+        for (uint32_t r = 0; r < nodeCount; ++r) lowerOffsets[r + 1] += lowerOffsets[r];
+        lowerArcs.resize(arcHeads.size());
+        lowerSources.resize(arcHeads.size());
+        vector<uint32_t> cursor(lowerOffsets.begin(), lowerOffsets.end() - 1);
+        for (uint32_t r = 0; r < nodeCount; ++r) {
+            for (uint32_t a = arcOffsets[r]; a < arcOffsets[r + 1]; ++a) {
+                uint32_t slot = cursor[arcHeads[a]]++;
+                lowerArcs[slot] = a;
+                lowerSources[slot] = r;
+            }
+        }
+
+        edgeArc.assign(csr.getEdgeCount(), CSRGraph::INVALID_NODE);
+        edgeUpward.assign(csr.getEdgeCount(), 0);
+        for (uint32_t u = 0; u < nodeCount; ++u) {
+            for (uint32_t e = csr.edgeBegin(u); e < csr.edgeEnd(u); ++e) {
+                uint32_t ru = rank[u];
+                uint32_t rv = rank[csr.getTarget(e)];
+                if (ru == rv) continue;
+                edgeArc[e] = findArc(min(ru, rv), max(ru, rv));
+                edgeUpward[e] = ru < rv;
+            }
+        }
+    }
+
+    unsigned long long getTopologyVersion() const { return topologyVersion; }
+    size_t getArcCount() const { return arcHeads.size(); }
+
+    // Mengisi metric dari bobot per edge CSR (indeks sama dengan kolom
+    // CSRGraph). Arc (x, y) diperbaiki lewat setiap segitiga bawah r < x;
+    // node x diproses urut rank (atau urut level elimination tree jika pakai
+    // pool) sehingga arc (r, x) dan (r, y) sudah final. Hasilnya sama persis
+    // dengan atau tanpa pool.
+    void customize(const vector<double>& weights, unsigned long long version, Metric& metric,
+                   ThreadPool* pool = nullptr) const {
+        const double infinity = numeric_limits<double>::infinity();
+        size_t arcCount = arcHeads.size();
+        metric.version = version;
+        metric.up.assign(arcCount, infinity);
+        metric.down.assign(arcCount, infinity);
+        metric.upMiddle.assign(arcCount, CSRGraph::INVALID_NODE);
+        metric.downMiddle.assign(arcCount, CSRGraph::INVALID_NODE);
+
+        for (size_t e = 0; e < edgeArc.size(); ++e) {
+            uint32_t arc = edgeArc[e];
+            if (arc == CSRGraph::INVALID_NODE) continue;
+            double& slot = edgeUpward[e] ? metric.up[arc] : metric.down[arc];
+            slot = min(slot, weights[e]);
+        }
+
+        ArcValues values = { metric.up.data(), metric.down.data(), metric.upMiddle.data(), metric.downMiddle.data() };
+        if (pool == nullptr || pool->size() <= 1) {
+            vector<uint32_t> arcTo(nodeCount);
+            for (uint32_t x = 0; x < nodeCount; ++x) {
+                mapUpperArcs(x, arcTo);
+                relaxLowerTriangles(lowerOffsets[x], lowerOffsets[x + 1], arcTo, metric, values, 0);
+            }
+            return;
+        }
+
+        size_t threadCount = pool->size();
+        vector<vector<uint32_t>> arcTo(threadCount);
+        arcTo[0].resize(nodeCount);
+        for (size_t level = 0; level + 1 < levelOffsets.size(); ++level) {
+            uint32_t first = levelOffsets[level], last = levelOffsets[level + 1];
+            if (last - first >= PARALLEL_LEVEL_NODES) {
+                for (size_t chunk = 0; chunk < threadCount; ++chunk) {
+                    uint32_t begin = first + static_cast<uint32_t>((last - first) * chunk / threadCount);
+                    uint32_t end = first + static_cast<uint32_t>((last - first) * (chunk + 1) / threadCount);
+                    pool->submit([this, &arcTo, &metric, values, chunk, begin, end]() {
+                        vector<uint32_t>& scratch = arcTo[chunk];
+                        scratch.resize(nodeCount);
+                        for (uint32_t i = begin; i < end; ++i) {
+                            uint32_t x = levelNodes[i];
+                            mapUpperArcs(x, scratch);
+                            relaxLowerTriangles(lowerOffsets[x], lowerOffsets[x + 1], scratch, metric, values, 0);
+                        }
+                    });
+                }
+                pool->wait();
+                continue;
+            }
+
+            for (uint32_t i = first; i < last; ++i) {
+                uint32_t x = levelNodes[i];
+                mapUpperArcs(x, arcTo[0]);
+                uint32_t lowerCount = lowerOffsets[x + 1] - lowerOffsets[x];
+                if (lowerCount < PARALLEL_LOWER_ARCS) {
+                    relaxLowerTriangles(lowerOffsets[x], lowerOffsets[x + 1], arcTo[0], metric, values, 0);
+                } else {
+                    relaxNodeParallel(x, arcTo[0], metric, values, *pool);
+                }
+            }
+        }
+    }
+
+    // Query tanpa priority queue: ruang pencarian maju dan mundur adalah
+    // leluhur start dan end di elimination tree. Kedua jalur ditelusuri urut
+    // rank; setelah bertemu, node yang biayanya sudah >= rute terbaik tidak
+    // direlaksasi lagi. Mengisi path (ID node asli) dan mengembalikan biaya;
+    // infinity jika tidak ada rute.
+    double query(const Metric& metric, uint32_t startId, uint32_t endId, Workspace& ws,
+                 vector<uint32_t>& path, size_t& settled) const {
+        const double infinity = numeric_limits<double>::infinity();
+        ws.reset(nodeCount);
+        path.clear();
+        settled = 0;
+
+        uint32_t source = rank[startId];
+        uint32_t target = rank[endId];
+        ws.forward[source] = 0;
+        ws.backward[target] = 0;
+
+        double best = infinity;
+        uint32_t meeting = CSRGraph::INVALID_NODE;
+        uint32_t forwardNode = source, backwardNode = target;
+        while (forwardNode != CSRGraph::INVALID_NODE || backwardNode != CSRGraph::INVALID_NODE) {
+            // INVALID_NODE lebih besar dari rank mana pun
+            uint32_t v = min(forwardNode, backwardNode);
+            bool forward = forwardNode == v;
+            bool backward = backwardNode == v;
+            if (forward && backward && ws.forward[v] + ws.backward[v] < best) {
+                best = ws.forward[v] + ws.backward[v];
+                meeting = v;
+            }
+
+            if (forward) {
+                ++settled;
+                double base = ws.forward[v];
+                if (base < best) {
+                    for (uint32_t a = arcOffsets[v]; a < arcOffsets[v + 1]; ++a) {
+                        uint32_t x = arcHeads[a];
+                        if (base + metric.up[a] < ws.forward[x]) {
+                            ws.forward[x] = base + metric.up[a];
+                            ws.forwardPrevious[x] = v;
+                        }
+                    }
+                }
+                forwardNode = parent[v];
+            }
+            if (backward) {
+                ++settled;
+                double base = ws.backward[v];
+                if (base < best) {
+                    for (uint32_t a = arcOffsets[v]; a < arcOffsets[v + 1]; ++a) {
+                        uint32_t x = arcHeads[a];
+                        if (base + metric.down[a] < ws.backward[x]) {
+                            ws.backward[x] = base + metric.down[a];
+                            ws.backwardPrevious[x] = v;
+                        }
+                    }
+                }
+                backwardNode = parent[v];
+            }
+        }
+
+        if (meeting != CSRGraph::INVALID_NODE) {
+            vector<uint32_t> upPath;
+            for (uint32_t v = meeting; v != CSRGraph::INVALID_NODE; v = ws.forwardPrevious[v]) {
+                upPath.push_back(v);
+            }
+            reverse(upPath.begin(), upPath.end());
+            for (uint32_t v = meeting; v != target; ) {
+                v = ws.backwardPrevious[v];
+                upPath.push_back(v);
+            }
+
+            path.push_back(order[upPath.front()]);
+            for (size_t i = 0; i + 1 < upPath.size(); ++i) {
+                unpack(metric, upPath[i], upPath[i + 1], path);
+            }
+        }
+
+        for (uint32_t v = source; v != CSRGraph::INVALID_NODE; v = parent[v]) {
+            ws.forward[v] = infinity;
+            ws.forwardPrevious[v] = CSRGraph::INVALID_NODE;
+        }
+        for (uint32_t v = target; v != CSRGraph::INVALID_NODE; v = parent[v]) {
+            ws.backward[v] = infinity;
+            ws.backwardPrevious[v] = CSRGraph::INVALID_NODE;
+        }
+        return best;
+    }
+};
+
+#endif
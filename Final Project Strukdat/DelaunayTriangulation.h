@@ -0,0 +1,415 @@
+#ifndef DELAUNAY_TRIANGULATION_H
+#define DELAUNAY_TRIANGULATION_H
+
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+
+// Triangulasi Delaunay 2D dengan algoritma sweep-hull: titik diurutkan
+// menurut jarak dari pusat segitiga awal lalu ditambahkan satu per satu ke
+// luar convex hull, dan edge yang melanggar sifat Delaunay di-flip. Posisi
+// titik baru di hull dicari lewat tabel hash sudut, sehingga waktunya
+// praktis O(n log n) (didominasi pengurutan).
+//
+// Hasil disimpan sebagai halfedge: segitiga t memakai halfedge 3t, 3t+1,
+// 3t+2; halfedge e berawal di triangles[e] dan berakhir di
+// triangles[nextHalfedge(e)]; halfedges[e] adalah pasangannya di segitiga
+// tetangga (INVALID untuk edge di convex hull). Titik dengan koordinat sama
+// persis hanya diambil sekali. Jika semua titik segaris tidak ada segitiga;
+// urutan titik di sepanjang garis tersedia lewat getCollinearChain().
+class DelaunayTriangulation {
+public:
+    static constexpr uint32_t INVALID = numeric_limits<uint32_t>::max();
+
+private:
+    const vector<double>& xs;
+    const vector<double>& ys;
+    vector<uint32_t> triangles;
+    vector<uint32_t> halfedges;
+    vector<uint32_t> collinearChain;
+
+    // Convex hull sementara sebagai linked list melingkar
+    vector<uint32_t> hullPrev;
+    vector<uint32_t> hullNext;
+    vector<uint32_t> hullTri;
+    vector<uint32_t> hullHash;
+    uint32_t hullStart;
+    double centerX;
+    double centerY;
+    vector<uint32_t> edgeStack;
+
+    // Penjumlahan dan perkalian tanpa galat: hasil + sisa = nilai eksak
+    static void twoSum(double a, double b, double& sum, double& error) {
+        sum = a + b;
+        double bVirtual = sum - a;
+        double aVirtual = sum - bVirtual;
+        error = (a - aVirtual) + (b - bVirtual);
+    }
+
+    static void twoProduct(double a, double b, double& product, double& error) {
+        product = a * b;
+        error = fma(a, b, -product);
+    }
+
+    // Tanda eksak (ax-cx)(by-cy) - (ay-cy)(bx-cx): setiap selisih dipecah
+    // menjadi nilai + sisa, setiap hasil kali dihitung tanpa galat, lalu
+    // semua suku dijumlahkan sebagai expansion (Shewchuk) yang tanda
+    // komponen terbesarnya adalah tanda determinan
+    static double exactOrientation(double ax, double ay, double bx, double by, double cx, double cy) {
+        double acx, acxTail, bcy, bcyTail, acy, acyTail, bcx, bcxTail;
+        twoSum(ax, -cx, acx, acxTail);
+        twoSum(by, -cy, bcy, bcyTail);
+        twoSum(ay, -cy, acy, acyTail);
+        twoSum(bx, -cx, bcx, bcxTail);
+
+        const double left[2] = { acx, acxTail };
+        const double right[2] = { bcy, bcyTail };
+        const double negLeft[2] = { -acy, -acyTail };
+        const double negRight[2] = { bcx, bcxTail };
+
+        double expansion[17];
+        size_t length = 0;
+        auto grow = [&expansion, &length](double value) {
+            size_t kept = 0;
+            for (size_t i = 0; i < length; ++i) {
+                double error;
+                twoSum(value, expansion[i], value, error);
+                if (error != 0) expansion[kept++] = error;
+            }
+            expansion[kept++] = value;
+            length = kept;
+        };
+        for (int i = 0; i < 2; ++i) {
+            for (int j = 0; j < 2; ++j) {
+                double product, error;
+                twoProduct(left[i], right[j], product, error);
+                grow(error);
+                grow(product);
+                twoProduct(negLeft[i], negRight[j], product, error);
+                grow(error);
+                grow(product);
+            }
+        }
+        for (size_t i = length; i-- > 0;) {
+            if (expansion[i] != 0) return expansion[i];
+        }
+        return 0;
+    }
+
+    // Positif jika a, b, c berlawanan arah jarum jam, negatif jika searah,
+    // nol jika segaris. Hasil floating point hanya dipakai bila jauh dari
+    // nol menurut batas galatnya; selain itu dihitung eksak.
+    static double orientation(double ax, double ay, double bx, double by, double cx, double cy) {
+        double detLeft = (ax - cx) * (by - cy);
+        double detRight = (ay - cy) * (bx - cx);
+        double det = detLeft - detRight;
+        const double ERROR_BOUND = (3.0 + 16.0 * numeric_limits<double>::epsilon() / 2)
+                                   * numeric_limits<double>::epsilon() / 2;
+        if (fabs(det) > ERROR_BOUND * (fabs(detLeft) + fabs(detRight))) return det;
+        return exactOrientation(ax, ay, bx, by, cx, cy);
+    }
+
+    // true jika p, q, r berlawanan arah jarum jam
+    bool orient(uint32_t p, uint32_t q, uint32_t r) const {
+        return orient(xs[p], ys[p], xs[q], ys[q], xs[r], ys[r]);
+    }
+
+    static bool orient(double px, double py, double qx, double qy, double rx, double ry) {
+        return orientation(px, py, qx, qy, rx, ry) > 0;
+    }
+
+    // true jika p berada di dalam lingkaran luar segitiga a, b, c
+    bool inCircle(uint32_t a, uint32_t b, uint32_t c, uint32_t p) const {
+        double dx = xs[a] - xs[p], dy = ys[a] - ys[p];
+        double ex = xs[b] - xs[p], ey = ys[b] - ys[p];
+        double fx = xs[c] - xs[p], fy = ys[c] - ys[p];
+        double ap = dx * dx + dy * dy;
+        double bp = ex * ex + ey * ey;
+        double cp = fx * fx + fy * fy;
+        return dx * (ey * cp - bp * fy) - dy * (ex * cp - bp * fx) + ap * (ex * fy - ey * fx) < 0;
+    }
+
+    // Kuadrat jari-jari lingkaran luar; infinity untuk titik segaris
+    double circumradius(uint32_t a, uint32_t b, uint32_t c) const {
+        double dx = xs[b] - xs[a], dy = ys[b] - ys[a];
+        double ex = xs[c] - xs[a], ey = ys[c] - ys[a];
+        double bl = dx * dx + dy * dy;
+        double cl = ex * ex + ey * ey;
+        double d = 0.5 / (dx * ey - dy * ex);
+        double x = (ey * bl - dy * cl) * d;
+        double y = (dx * cl - ex * bl) * d;
+        double radius = x * x + y * y;
+        return radius == radius ? radius : numeric_limits<double>::infinity();
+    }
+
+    void circumcenter(uint32_t a, uint32_t b, uint32_t c, double& x, double& y) const {
+        double dx = xs[b] - xs[a], dy = ys[b] - ys[a];
+        double ex = xs[c] - xs[a], ey = ys[c] - ys[a];
+        double bl = dx * dx + dy * dy;
+        double cl = ex * ex + ey * ey;
+        double d = 0.5 / (dx * ey - dy * ex);
+        x = xs[a] + (ey * bl - dy * cl) * d;
+        y = ys[a] + (dx * cl - ex * bl) * d;
+    }
+
+    // Sudut semu dari pusat dalam [0, 1), monoton terhadap sudut sebenarnya
+    size_t hashKey(double x, double y) const {
+        double dx = x - centerX;
+        double dy = y - centerY;
+        if (dx == 0 && dy == 0) return 0;
+        double p = dx / (fabs(dx) + fabs(dy));
+        double angle = (dy > 0 ? 3 - p : 1 + p) / 4;
+        return static_cast<size_t>(floor(angle * hullHash.size())) % hullHash.size();
+    }
+
+    void link(uint32_t a, uint32_t b) {
+        halfedges[a] = b;
+        if (b != INVALID) halfedges[b] = a;
+    }
+
+    uint32_t addTriangle(uint32_t i0, uint32_t i1, uint32_t i2, uint32_t a, uint32_t b, uint32_t c) {
+        uint32_t t = static_cast<uint32_t>(triangles.size());
+        triangles.push_back(i0);
+        triangles.push_back(i1);
+        triangles.push_back(i2);
+        halfedges.resize(triangles.size(), INVALID);
+        link(t, a);
+        link(t + 1, b);
+        link(t + 2, c);
+        return t;
+    }
+
+    // Flip edge yang melanggar sifat Delaunay mulai dari halfedge a, secara
+    // iteratif lewat edgeStack. Mengembalikan halfedge yang menggantikan
+    // tepi luar segitiga a setelah flip.
+    uint32_t legalize(uint32_t a) {
+        uint32_t ar = 0;
+        edgeStack.clear();
+        while (true) {
+            uint32_t b = halfedges[a];
+            uint32_t a0 = a - a % 3;
+            ar = a0 + (a + 2) % 3;
+
+            if (b == INVALID) {
+                if (edgeStack.empty()) break;
+                a = edgeStack.back();
+                edgeStack.pop_back();
+                continue;
+            }
+
+            uint32_t b0 = b - b % 3;
+            uint32_t al = a0 + (a + 1) % 3;
+            uint32_t bl = b0 + (b + 2) % 3;
+            uint32_t p0 = triangles[ar];
+            uint32_t pr = triangles[a];
+            uint32_t pl = triangles[al];
+            uint32_t p1 = triangles[bl];
+
+            if (inCircle(p0, pr, pl, p1)) {
+                triangles[a] = p1;
+                triangles[b] = p0;
+                uint32_t hbl = halfedges[bl];
+
+                // Edge yang di-flip berada di hull: perbarui referensi hullTri
+                if (hbl == INVALID) {
+                    uint32_t e = hullStart;
+                    do {
+                        if (hullTri[e] == bl) {
+                            hullTri[e] = a;
+                            break;
+                        }
+                        e = hullPrev[e];
+                    } while (e != hullStart);
+                }
+                link(a, hbl);
+                link(b, halfedges[ar]);
+                link(ar, bl);
+                edgeStack.push_back(b0 + (b + 1) % 3);
+            } else {
+                if (edgeStack.empty()) break;
+                a = edgeStack.back();
+                edgeStack.pop_back();
+            }
+        }
+        return ar;
+    }
+
+    void build() {
+        size_t n = xs.size();
+        if (n == 0) return;
+
+        // Titik dengan koordinat sama hanya diambil sekali
+        vector<uint32_t> ids(n);
+        iota(ids.begin(), ids.end(), 0);
+        sort(ids.begin(), ids.end(), [this](uint32_t a, uint32_t b) {
+            return xs[a] != xs[b] ? xs[a] < xs[b] : (ys[a] != ys[b] ? ys[a] < ys[b] : a < b);
+        });
+        ids.erase(std::unique(ids.begin(), ids.end(), [this](uint32_t a, uint32_t b) {
+            return xs[a] == xs[b] && ys[a] == ys[b];
+        }), ids.end());
+        if (ids.size() < 3) {
+            collinearChain = ids;
+            return;
+        }
+
+        double minX = numeric_limits<double>::infinity(), maxX = -minX;
+        double minY = minX, maxY = -minX;
+        for (uint32_t i : ids) {
+            minX = min(minX, xs[i]);
+            maxX = max(maxX, xs[i]);
+            minY = min(minY, ys[i]);
+            maxY = max(maxY, ys[i]);
+        }
+        double midX = (minX + maxX) / 2;
+        double midY = (minY + maxY) / 2;
+
+        // Segitiga awal: titik terdekat ke tengah, tetangga terdekatnya, dan
+        // titik yang membentuk lingkaran luar terkecil bersama keduanya
+        uint32_t i0 = INVALID, i1 = INVALID, i2 = INVALID;
+        double best = numeric_limits<double>::infinity();
+        for (uint32_t i : ids) {
+            double d = (xs[i] - midX) * (xs[i] - midX) + (ys[i] - midY) * (ys[i] - midY);
+            if (d < best) {
+                best = d;
+                i0 = i;
+            }
+        }
+        best = numeric_limits<double>::infinity();
+        for (uint32_t i : ids) {
+            if (i == i0) continue;
+            double d = (xs[i] - xs[i0]) * (xs[i] - xs[i0]) + (ys[i] - ys[i0]) * (ys[i] - ys[i0]);
+            if (d < best) {
+                best = d;
+                i1 = i;
+            }
+        }
+        best = numeric_limits<double>::infinity();
+        for (uint32_t i : ids) {
+            if (i == i0 || i == i1) continue;
+            double r = circumradius(i0, i1, i);
+            if (r < best) {
+                best = r;
+                i2 = i;
+            }
+        }
+        if (i2 == INVALID) {
+            // Semua titik segaris: urutan (x, y) sudah urutan di sepanjang garis
+            collinearChain = ids;
+            return;
+        }
+        if (orient(i0, i1, i2)) swap(i1, i2);
+        circumcenter(i0, i1, i2, centerX, centerY);
+
+        vector<double> dists(n);
+        for (uint32_t i : ids) {
+            dists[i] = (xs[i] - centerX) * (xs[i] - centerX) + (ys[i] - centerY) * (ys[i] - centerY);
+        }
+        sort(ids.begin(), ids.end(), [&dists](uint32_t a, uint32_t b) {
+            return dists[a] != dists[b] ? dists[a] < dists[b] : a < b;
+        });
+
+        hullPrev.assign(n, INVALID);
+        hullNext.assign(n, INVALID);
+        hullTri.assign(n, INVALID);
+        hullHash.assign(static_cast<size_t>(ceil(sqrt(static_cast<double>(ids.size())))), INVALID);
+        hullStart = i0;
+        hullNext[i0] = hullPrev[i2] = i1;
+        hullNext[i1] = hullPrev[i0] = i2;
+        hullNext[i2] = hullPrev[i1] = i0;
+        hullTri[i0] = 0;
+        hullTri[i1] = 1;
+        hullTri[i2] = 2;
+        hullHash[hashKey(xs[i0], ys[i0])] = i0;
+        hullHash[hashKey(xs[i1], ys[i1])] = i1;
+        hullHash[hashKey(xs[i2], ys[i2])] = i2;
+
+        size_t maxTriangles = 2 * ids.size() - 5;
+        triangles.reserve(maxTriangles * 3);
+        halfedges.reserve(maxTriangles * 3);
+        addTriangle(i0, i1, i2, INVALID, INVALID, INVALID);
+
+        for (uint32_t i : ids) {
+            if (i == i0 || i == i1 || i == i2) continue;
+            double x = xs[i], y = ys[i];
+
+            // Cari edge hull yang terlihat dari titik baru, mulai dari hash sudutnya
+            uint32_t start = INVALID;
+            size_t key = hashKey(x, y);
+            for (size_t j = 0; j < hullHash.size(); ++j) {
+                start = hullHash[(key + j) % hullHash.size()];
+                if (start != INVALID && start != hullNext[start]) break;
+            }
+            start = hullPrev[start];
+            uint32_t e = start;
+            uint32_t q;
+            while (q = hullNext[e], !orient(x, y, xs[e], ys[e], xs[q], ys[q])) {
+                e = q;
+                if (e == start) {
+                    e = INVALID;
+                    break;
+                }
+            }
+            // Titik (hampir) berada di hull secara numerik; dilewati
+            if (e == INVALID) continue;
+
+            uint32_t t = addTriangle(e, i, hullNext[e], INVALID, INVALID, hullTri[e]);
+            hullTri[i] = legalize(t + 2);
+            hullTri[e] = t;
+
+            // Tambah segitiga ke depan sepanjang hull yang masih terlihat
+            uint32_t next = hullNext[e];
+            while (q = hullNext[next], orient(x, y, xs[next], ys[next], xs[q], ys[q])) {
+                t = addTriangle(next, i, q, hullTri[i], INVALID, hullTri[next]);
+                hullTri[i] = legalize(t + 2);
+                hullNext[next] = next;  // keluar dari hull
+                next = q;
+            }
+
+            // ... dan ke belakang
+            if (e == start) {
+                while (q = hullPrev[e], orient(x, y, xs[q], ys[q], xs[e], ys[e])) {
+                    t = addTriangle(q, i, e, INVALID, hullTri[e], hullTri[q]);
+                    legalize(t + 2);
+                    hullTri[q] = t;
+                    hullNext[e] = e;
+                    e = q;
+                }
+            }
+
+            hullStart = hullPrev[i] = e;
+            hullNext[e] = hullPrev[next] = i;
+            hullNext[i] = next;
+            hullHash[hashKey(x, y)] = i;
+            hullHash[hashKey(xs[e], ys[e])] = e;
+        }
+
+        hullPrev.clear();
+        hullNext.clear();
+        hullTri.clear();
+        hullHash.clear();
+    }
+
+public:
+    // xs dan ys harus tetap hidup selama objek ini dipakai
+    DelaunayTriangulation(const vector<double>& xs, const vector<double>& ys)
+        : xs(xs), ys(ys), hullStart(INVALID), centerX(0), centerY(0) {
+        build();
+    }
+
+    static uint32_t nextHalfedge(uint32_t e) { return e % 3 == 2 ? e - 2 : e + 1; }
+    static uint32_t prevHalfedge(uint32_t e) { return e % 3 == 0 ? e + 2 : e - 1; }
+
+    const vector<uint32_t>& getTriangles() const { return triangles; }
+    const vector<uint32_t>& getHalfedges() const { return halfedges; }
+    size_t getTriangleCount() const { return triangles.size() / 3; }
+
+    // Titik unik terurut di sepanjang garis jika tidak ada segitiga
+    const vector<uint32_t>& getCollinearChain() const { return collinearChain; }
+};
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef DELTA_STEPPING_H
+#define DELTA_STEPPING_H
+
+#include "CSRGraph.h"
+#include "ThreadPool.h"
+#include <vector>
+#include <map>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// SSSP paralel delta-stepping (Meyer & Sanders) untuk perhitungan satu
+// sumber ke seluruh graf: isochrone, matriks jarak, analitik.
+//
+// Node dikelompokkan ke bucket selebar delta menurut jarak sementaranya.
+// Bucket terkecil diproses berulang: edge ringan (bobot <= delta) dari
+// frontier direlaksasi paralel sampai bucket kosong, lalu edge berat dari
+// semua node yang selesai di bucket itu direlaksasi sekali. Jarak disimpan
+// sebagai atomic<double> dan diperbarui dengan compare-exchange (atomic min);
+// setiap potongan kerja mencatat node yang membaik di buffer sendiri,
+// kemudian buffer digabung ke bucket tanpa lock.
+class DeltaStepping {
+private:
+    // Potongan frontier lebih kecil dari ini dikerjakan di thread pemanggil,
+    // karena biaya submit ke pool lebih besar dari pekerjaannya
+    static constexpr size_t PARALLEL_GRAIN = 512;
+
+    unique_ptr<atomic<double>[]> distance;
+    size_t capacity;
+    map<uint64_t, vector<uint32_t>> buckets;
+    vector<vector<uint32_t>> chunkUpdates;
+    vector<uint32_t> frontier;
+    vector<uint32_t> bucketSettled;
+    vector<char> inFrontier;
+    vector<char> inSettled;
+    size_t phases;
+
+    static bool atomicMin(atomic<double>& target, double value) {
+        double current = target.load(memory_order_relaxed);
+        while (value < current) {
+            if (target.compare_exchange_weak(current, value, memory_order_relaxed)) return true;
+        }
+        return false;
+    }
+
+    // Membagi [0, count) menjadi beberapa potongan; fn(chunk, begin, end)
+    template <typename ChunkFn>
+    size_t parallelFor(ThreadPool* pool, size_t count, ChunkFn fn) {
+        size_t chunks = 1;
+        if (pool != nullptr && pool->size() > 1 && count >= 2 * PARALLEL_GRAIN) {
+            chunks = min(pool->size() * 4, count / PARALLEL_GRAIN);
+        }
+        if (chunkUpdates.size() < chunks) chunkUpdates.resize(chunks);
+
+        if (chunks == 1) {
+            fn(0, 0, count);
+            return 1;
+        }
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            size_t first = count * chunk / chunks;
+            size_t last = count * (chunk + 1) / chunks;
+            pool->submit([&fn, chunk, first, last]() { fn(chunk, first, last); });
+        }
+        pool->wait();
+        return chunks;
+    }
+
+    // Relaksasi paralel edge ringan (light = true) atau berat dari nodes
+    void relax(const CSRGraph& csr, const double* weights, double delta,
+               const vector<uint32_t>& nodes, bool light, ThreadPool* pool) {
+        size_t chunks = parallelFor(pool, nodes.size(), [&](size_t chunk, size_t first, size_t last) {
+            vector<uint32_t>& updated = chunkUpdates[chunk];
+            updated.clear();
+            for (size_t i = first; i < last; ++i) {
+                uint32_t u = nodes[i];
+                double base = distance[u].load(memory_order_relaxed);
+                for (uint32_t e = csr.edgeBegin(u); e < csr.edgeEnd(u); ++e) {
+                    double weight = weights[e];
+                    if ((weight <= delta) != light) continue;
+                    uint32_t v = csr.getTarget(e);
+                    if (atomicMin(distance[v], base + weight)) updated.push_back(v);
+                }
+            }
+        });
+
+        // Node bisa tercatat lebih dari sekali; duplikat dan entri basi
+        // dibuang saat bucket diambil
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            for (uint32_t v : chunkUpdates[chunk]) {
+                buckets[bucketOf(distance[v].load(memory_order_relaxed), delta)].push_back(v);
+            }
+        }
+    }
+
+    static uint64_t bucketOf(double value, double delta) {
+        return static_cast<uint64_t>(value / delta);
+    }
+
+public:
+    DeltaStepping() : capacity(0), phases(0) {}
+
+    // Delta default: dua kali rata-rata bobot positif. Delta kecil membuat
+    // banyak fase dengan frontier sempit, delta besar membuat node
+    // direlaksasi berulang kali seperti Bellman-Ford.
+    static double suggestDelta(const vector<double>& weights) {
+        double sum = 0;
+        size_t count = 0;
+        for (double weight : weights) {
+            if (weight > 0 && weight != numeric_limits<double>::infinity()) {
+                sum += weight;
+                ++count;
+            }
+        }
+        return count == 0 ? 1.0 : 2.0 * sum / count;
+    }
+
+    // Mengisi out dengan jarak dari sourceId ke setiap node (infinity jika
+    // tidak terjangkau atau lebih dari maxCost). pool boleh nullptr untuk
+    // menjalankan semuanya di thread pemanggil.
+    void run(const CSRGraph& csr, const vector<double>& weightColumn, uint32_t sourceId,
+             double delta, ThreadPool* pool, vector<double>& out,
+             double maxCost = numeric_limits<double>::infinity()) {
+        const double infinity = numeric_limits<double>::infinity();
+        size_t nodeCount = csr.getNodeCount();
+        if (capacity < nodeCount) {
+            distance.reset(new atomic<double>[nodeCount]);
+            capacity = nodeCount;
+        }
+        if (inFrontier.size() != nodeCount) {
+            inFrontier.assign(nodeCount, 0);
+            inSettled.assign(nodeCount, 0);
+        }
+        parallelFor(pool, nodeCount, [this, infinity](size_t, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) distance[i].store(infinity, memory_order_relaxed);
+        });
+
+        if (delta <= 0) delta = suggestDelta(weightColumn);
+        const double* weights = weightColumn.data();
+        buckets.clear();
+        phases = 0;
+
+        distance[sourceId].store(0, memory_order_relaxed);
+        buckets[0].push_back(sourceId);
+
+        while (!buckets.empty()) {
+            uint64_t index = buckets.begin()->first;
+            if (index * delta > maxCost) break;
+            bucketSettled.clear();
+
+            // Fase ringan diulang karena relaksasi bisa mengisi bucket ini lagi
+            while (true) {
+                auto it = buckets.find(index);
+                if (it == buckets.end()) break;
+                frontier.clear();
+                for (uint32_t v : it->second) {
+                    if (inFrontier[v] || bucketOf(distance[v].load(memory_order_relaxed), delta) != index) continue;
+                    inFrontier[v] = 1;
+                    frontier.push_back(v);
+                    if (!inSettled[v]) {
+                        inSettled[v] = 1;
+                        bucketSettled.push_back(v);
+                    }
+                }
+                buckets.erase(it);
+                for (uint32_t v : frontier) inFrontier[v] = 0;
+                if (frontier.empty()) break;
+
+                ++phases;
+                relax(csr, weights, delta, frontier, true, pool);
+            }
+
+            ++phases;
+            relax(csr, weights, delta, bucketSettled, false, pool);
+            for (uint32_t v : bucketSettled) inSettled[v] = 0;
+        }
+
+        out.resize(nodeCount);
+        parallelFor(pool, nodeCount, [this, &out, maxCost, infinity](size_t, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                double value = distance[i].load(memory_order_relaxed);
+                out[i] = value > maxCost ? infinity : value;
+            }
+        });
+    }
+
+    // Jumlah fase relaksasi (sinkronisasi) pada run terakhir
+    size_t getLastPhaseCount() const { return phases; }
+};
+
+#endif
@@ -5,10 +5,25 @@
 using namespace std;
 #include "GraphManager.h"
 #include "PreferenceManager.h"
-#include <queue>
-#include <map>
-#include <set>
+#include "CSRGraph.h"
+#include "SearchWorkspace.h"
+#include "ContractionHierarchy.h"
+#include "CustomizableHierarchy.h"
+#include "LandmarkIndex.h"
+#include "QueryCache.h"
+#include "WeightPolicy.h"
+#include "PreferenceScores.h"
+#include "ParetoSearch.h"
+#include "KShortestPaths.h"
+#include "ConstrainedSearch.h"
+#include "DynamicShortestPathTree.h"
+#include "DeltaStepping.h"
+#include "RadixHeap.h"
 #include <vector>
+#include <memory>
+#include <map>
+#include <sstream>
+#include <iomanip>
 #include <string>
 #include <limits>
 #include <algorithm>
@@ -16,127 +31,1063 @@ using namespace std;
 struct PathResult {
     vector<string> path;
     double totalCost;
+    size_t settledNodes;  // Jumlah node yang diselesaikan selama pencarian
+    
+    PathResult() : totalCost(0), settledNodes(0) {}
+    PathResult(const vector<string>& path, double cost, size_t settledNodes = 0) 
+        : path(path), totalCost(cost), settledNodes(settledNodes) {}
+};
+
+// Batas opsional untuk menghentikan query yang tidak menjanjikan lebih awal
+struct SearchLimits {
+    double maxCost;
+    size_t maxSettledNodes;
     
-    PathResult() : totalCost(0) {}
-    PathResult(const vector<string>& path, double cost) 
-        : path(path), totalCost(cost) {}
+    SearchLimits()
+        : maxCost(numeric_limits<double>::infinity()),
+          maxSettledNodes(numeric_limits<size_t>::max()) {}
+    SearchLimits(double maxCost, size_t maxSettledNodes = numeric_limits<size_t>::max())
+        : maxCost(maxCost), maxSettledNodes(maxSettledNodes) {}
 };
 
+// Matriks biaya origin-destination, disimpan row-major:
+// values[i * targetCount + j] = biaya dari sources[i] ke targets[j]
+struct DistanceMatrix {
+    size_t sourceCount;
+    size_t targetCount;
+    vector<double> values;
+    
+    DistanceMatrix() : sourceCount(0), targetCount(0) {}
+    DistanceMatrix(size_t sourceCount, size_t targetCount)
+        : sourceCount(sourceCount), targetCount(targetCount),
+          values(sourceCount * targetCount, numeric_limits<double>::infinity()) {}
+    
+    double at(size_t source, size_t target) const {
+        return values[source * targetCount + target];
+    }
+};
+
+// Mesin untuk perhitungan satu sumber ke seluruh graf
+enum class SsspEngine {
+    SEQUENTIAL,      // Dijkstra heap di satu thread
+    DELTA_STEPPING   // delta-stepping paralel di thread pool
+};
+
+// Satu instance tidak aman dipakai beberapa thread sekaligus (workspace dan
+// cache ada di dalamnya). Untuk melayani query paralel saat graf sedang
+// diedit, buat satu instance per thread pekerja dengan setSnapshotIsolation(true).
 class DijkstraAlgorithm {
 private:
+    // Jumlah kolom skor preferensi yang disimpan sebelum cache dikosongkan
+    static constexpr size_t SCORE_COLUMN_CACHE_SIZE = 8;
+
     const GraphManager& graph;
+    mutable shared_ptr<const CSRGraph> snapshot;
+    mutable SearchWorkspace workspace;
+    mutable SearchWorkspace reverseWorkspace;
+    mutable shared_ptr<const ContractionHierarchy> hierarchies[3];  // per WeightColumn
+    mutable shared_ptr<const CustomizableHierarchy> customizable;
+    mutable map<string, shared_ptr<const CustomizableHierarchy::Metric>> customizedMetrics;  // kunci: preferensi
+    mutable CustomizableHierarchy::Workspace customizableWorkspace;
+    mutable map<string, pair<unsigned long long, shared_ptr<const LandmarkIndex>>> landmarkIndexes;
+    mutable map<string, pair<unsigned long long, shared_ptr<const vector<double>>>> scoreColumns;  // kunci: preferensi
+    size_t landmarkCount;
+    string landmarkDirectory;
+    mutable QueryCache<PathResult> resultCache;
+    mutable ParetoSearch paretoSearch;
+    mutable KShortestPaths kShortestPaths;
+    mutable ConstrainedSearch constrainedSearch;
+    mutable DeltaStepping deltaStepping;
+    mutable RadixWorkspace radixWorkspace;
+    mutable QuantizedWeights quantizedWeights[3];  // per WeightColumn
+    bool radixHeapEnabled;
+    size_t radixHeapMinNodes;
+    double quantizationTolerance;
+    map<string, unique_ptr<DynamicShortestPathTree>> trackedOrigins;  // kunci: origin + mode
+    bool snapshotIsolation;
+    bool customizableEnabled;
+    bool verbose;
+    mutable ostream silent;  // tanpa buffer: semua output dibuang
     
 public:
-    explicit DijkstraAlgorithm(const GraphManager& graph) : graph(graph) {}
+    explicit DijkstraAlgorithm(const GraphManager& graph)
+        : graph(graph), landmarkCount(8), landmarkDirectory("."), resultCache(1024),
+          radixHeapEnabled(true), radixHeapMinNodes(20000), quantizationTolerance(0),
+          snapshotIsolation(false),
+          customizableEnabled(false), verbose(true), silent(nullptr) {}
     virtual ~DijkstraAlgorithm() = default;
     
     PathResult findShortestPath(const string& start, const string& end, 
-                               const string& mode) const {
-        map<string, double> cost;
-        map<string, string> previous;
-        set<string> visited;
+                               const string& mode,
+                               const SearchLimits& limits = SearchLimits()) const {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return PathResult();
+        }
+
+        // Dengan snapshot isolation satu snapshot dipin untuk seluruh query,
+        // termasuk versi kunci cache. Tanpa isolation snapshot baru dibangun
+        // hanya jika benar-benar dibutuhkan (bukan untuk cache hit atau
+        // jawaban dari pohon origin yang dipantau).
+        shared_ptr<const CSRGraph> pinned;
+        if (snapshotIsolation) pinned = pinQuerySnapshot();
+
+        // Query dengan batas tidak di-cache karena hasilnya bergantung pada batas
+        bool cacheable = isUnbounded(limits);
+        string key = cacheable ? QueryCache<PathResult>::makeKey(start, end, mode) : "";
+        if (cacheable) {
+            const PathResult* cached = resultCache.find(key, cacheVersion(pinned));
+            if (cached != nullptr) return reportCached(*cached, start, end);
+        }
+
+        // Origin yang dipantau dijawab langsung dari pohon yang selalu mutakhir.
+        // Pohon diperbarui di thread writer, jadi tidak dipakai saat snapshot isolation.
+        if (cacheable && !snapshotIsolation) {
+            auto tracked = trackedOrigins.find(QueryCache<PathResult>::makeKey(start, "", mode));
+            if (tracked != trackedOrigins.end() && tracked->second->isValid()) {
+                PathResult result(tracked->second->getPath(end), tracked->second->getDistance(end));
+                if (result.path.empty()) result.totalCost = 0;
+                resultCache.insert(key, result, graph.getVersion());
+                return reportCached(result, start, end);
+            }
+        }
+
+        if (!pinned) pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        // Bobot integer (misalnya biaya dalam rupiah bulat) memakai radix heap
+        PathResult result;
+        const QuantizedWeights* integerWeights = getQuantizedWeights(csr, column);
+        if (integerWeights != nullptr) {
+            size_t settled = runRadixDijkstra(csr, startId, endId, limits, *integerWeights,
+                                              csr.getWeights(column), radixWorkspace);
+            result = reconstructPath(csr, startId, endId, radixWorkspace, settled);
+        } else {
+            size_t settled = withColumnPolicy(csr, column, [&](auto weightOf) {
+                return runDijkstra(csr, startId, endId, limits, workspace, weightOf);
+            });
+            result = reconstructPath(csr, startId, endId, workspace, settled);
+        }
+
+        if (cacheable) resultCache.insert(key, result, csr.getVersion());
+        return result;
+    }
+    
+    PathResult findBestRouteWithPreference(const string& start, const string& end, 
+                                          const PreferenceManager& pref,
+                                          const SearchLimits& limits = SearchLimits()) const {
+        shared_ptr<const CSRGraph> pinned;
+        if (snapshotIsolation) pinned = pinQuerySnapshot();
+
+        bool cacheable = isUnbounded(limits);
+        string key = cacheable ? QueryCache<PathResult>::makeKey(start, end, preferenceKey(pref)) : "";
+        if (cacheable) {
+            const PathResult* cached = resultCache.find(key, cacheVersion(pinned));
+            if (cached != nullptr) return reportCached(*cached, start, end);
+        }
 
-        auto cmp = [&cost](const string& a, const string& b) {
-            return cost[a] > cost[b];
-        };
-        priority_queue<string, vector<string>, decltype(cmp)> pq(cmp);
+        if (!pinned) pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
 
-        for (const auto& pair : graph.getLocations()) {
-            cost[pair.first] = numeric_limits<double>::infinity();
+        // Setelah prepareCustomizableHierarchy(), query tanpa batas dijawab CCH
+        PathResult result;
+        if (customizableEnabled && cacheable) {
+            result = queryCustomizable(csr, startId, endId, getCustomizedMetric(csr, pref));
+        } else {
+            size_t settled = runDijkstra(csr, startId, endId, limits, workspace,
+                                         ScoreColumnPolicy(getPreferenceScores(csr, pref)));
+            result = reconstructPath(csr, startId, endId, workspace, settled);
+        }
+        if (cacheable) resultCache.insert(key, result, csr.getVersion());
+        return result;
+    }
+    
+    // Dijkstra dengan policy bobot yang dipilih saat kompilasi (lihat
+    // WeightPolicy.h). Policy harus dibuat dari snapshot getSnapshot() saat ini.
+    // Hasilnya tidak di-cache karena policy tidak punya kunci.
+    template <typename WeightPolicy>
+    PathResult findShortestPathWith(const string& start, const string& end, const WeightPolicy& weightOf,
+                                    const SearchLimits& limits = SearchLimits()) const {
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
         }
 
-        cost[start] = 0;
-        pq.push(start);
+        size_t settled = runDijkstra(csr, startId, endId, limits, workspace, weightOf);
+        return reconstructPath(csr, startId, endId, workspace, settled);
+    }
+    
+    // Dijkstra dua arah: maju dari start dan mundur dari end secara bergantian
+    PathResult findShortestPathBidirectional(const string& start, const string& end,
+                                            const string& mode) const {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return PathResult();
+        }
 
-        while (!pq.empty()) {
-            string current = pq.top();
-            pq.pop();
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        return withColumnPolicy(csr, column, [&](auto weightOf) {
+            return runBidirectional(csr, startId, endId, weightOf);
+        });
+    }
+    
+    // A* dengan heuristik jarak garis lurus ke tujuan. Untuk "waktu" dan
+    // "biaya" jarak garis lurus dikalikan rasio bobot per km terkecil di graf,
+    // sehingga heuristik tetap admissible dan konsisten.
+    PathResult findShortestPathAStar(const string& start, const string& end,
+                                    const string& mode) const {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return PathResult();
+        }
+
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        // Sedikit dikecilkan agar galat pembulatan tidak membuat heuristik overestimate
+        double scale = csr.getMinWeightPerKm(column) * (1.0 - 1e-9);
+        return withColumnPolicy(csr, column, [&](auto weightOf) {
+            return runAStar(csr, startId, endId, weightOf,
+                [&csr, scale, endId](uint32_t v) { return scale * csr.straightLineDistance(v, endId); });
+        });
+    }
+    
+    // A* dengan batas bawah dari landmark (ALT). Berlaku untuk semua mode,
+    // termasuk yang tidak berkorelasi dengan jarak garis lurus.
+    PathResult findShortestPathALT(const string& start, const string& end,
+                                  const string& mode) const {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return PathResult();
+        }
+
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        const LandmarkIndex& index = getLandmarkIndex(csr, mode, csr.getWeights(column));
+        return withColumnPolicy(csr, column, [&](auto weightOf) {
+            return runAStar(csr, startId, endId, weightOf,
+                [&index, endId](uint32_t v) { return index.lowerBound(v, endId) * (1.0 - 1e-9); });
+        });
+    }
+    
+    // ALT untuk skor gabungan preferensi. Tabel landmark dibuat per kombinasi
+    // bobot preferensi dan disimpan ke disk seperti mode tunggal.
+    PathResult findBestRouteWithPreferenceALT(const string& start, const string& end,
+                                             const PreferenceManager& pref) const {
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        const vector<double>& scores = getPreferenceScores(csr, pref);
+        const LandmarkIndex& index = getLandmarkIndex(csr, preferenceKey(pref), scores);
+        return runAStar(csr, startId, endId,
+            [&scores](uint32_t e) { return scores[e]; },
+            [&index, endId](uint32_t v) { return index.lowerBound(v, endId) * (1.0 - 1e-9); });
+    }
+    
+    // Satu pencarian per source (berhenti setelah semua target diselesaikan),
+    // source dibagi ke beberapa thread dengan workspace masing-masing.
+    // Dengan DELTA_STEPPING source dihitung satu per satu dan semua thread
+    // mengerjakan source yang sama, cocok jika source lebih sedikit dari core.
+    DistanceMatrix computeDistanceMatrix(const vector<string>& sources, const vector<string>& targets,
+                                         const string& mode, size_t threadCount = 0,
+                                         SsspEngine engine = SsspEngine::SEQUENTIAL) const {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return DistanceMatrix();
+        }
 
-            if (visited.count(current)) continue;
-            visited.insert(current);
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        const vector<double>& weights = csr.getWeights(column);
+        DistanceMatrix matrix(sources.size(), targets.size());
 
-            for (const auto& route : graph.getRoutesFrom(current)) {
-                string neighbor = route.getDestination();
-                double weight = route.getWeightByMode(mode);
-                
-                if (weight == 0 && mode != "jarak" && mode != "waktu" && mode != "biaya") {
-                    cerr << "❌ Mode tidak dikenal!" << endl;
-                    return PathResult();
+        vector<uint32_t> sourceIds(sources.size()), targetIds(targets.size());
+        vector<char> isTarget(csr.getNodeCount(), 0);
+        size_t uniqueTargets = 0;
+        for (size_t i = 0; i < sources.size(); ++i) {
+            sourceIds[i] = csr.getId(sources[i]);
+            if (sourceIds[i] == CSRGraph::INVALID_NODE) {
+                errors() << "⚠️  Lokasi asal '" << sources[i] << "' tidak ditemukan." << endl;
+            }
+        }
+        for (size_t j = 0; j < targets.size(); ++j) {
+            targetIds[j] = csr.getId(targets[j]);
+            if (targetIds[j] == CSRGraph::INVALID_NODE) {
+                errors() << "⚠️  Lokasi tujuan '" << targets[j] << "' tidak ditemukan." << endl;
+            } else if (!isTarget[targetIds[j]]) {
+                isTarget[targetIds[j]] = 1;
+                ++uniqueTargets;
+            }
+        }
+
+        if (threadCount == 0) threadCount = ThreadPool::defaultThreadCount();
+        if (engine == SsspEngine::DELTA_STEPPING) {
+            ThreadPool pool(threadCount);
+            double delta = DeltaStepping::suggestDelta(weights);
+            vector<double> distances;
+            for (size_t i = 0; i < sources.size(); ++i) {
+                if (sourceIds[i] == CSRGraph::INVALID_NODE) continue;
+                deltaStepping.run(csr, weights, sourceIds[i], delta, &pool, distances);
+                for (size_t j = 0; j < targets.size(); ++j) {
+                    if (targetIds[j] != CSRGraph::INVALID_NODE) {
+                        matrix.values[i * targets.size() + j] = distances[targetIds[j]];
+                    }
                 }
+            }
+            return matrix;
+        }
+        threadCount = max<size_t>(1, min(threadCount, sources.size()));
 
-                double newCost = cost[current] + weight;
-                if (newCost < cost[neighbor]) {
-                    cost[neighbor] = newCost;
-                    previous[neighbor] = current;
-                    pq.push(neighbor);
+        // Beberapa blok per thread agar beban tetap seimbang
+        size_t blockCount = min(sources.size(), threadCount * 4);
+        ThreadPool pool(threadCount);
+        for (size_t block = 0; block < blockCount; ++block) {
+            size_t first = sources.size() * block / blockCount;
+            size_t last = sources.size() * (block + 1) / blockCount;
+            pool.submit([&, first, last]() {
+                SearchWorkspace ws;
+                for (size_t i = first; i < last; ++i) {
+                    if (sourceIds[i] == CSRGraph::INVALID_NODE) continue;
+                    fillMatrixRow(csr, weights, sourceIds[i], targetIds, isTarget, uniqueTargets,
+                                  ws, &matrix.values[i * targets.size()]);
                 }
+            });
+        }
+        pool.wait();
+
+        return matrix;
+    }
+    
+    // Jarak dari origin ke semua node, diindeks dengan ID snapshot CSR
+    // (getSnapshot().getName(id)); infinity untuk node yang tidak terjangkau
+    // atau lebih jauh dari maxCost. Kosong jika origin/mode tidak valid.
+    vector<double> computeDistancesFrom(const string& origin, const string& mode,
+                                        SsspEngine engine = SsspEngine::SEQUENTIAL,
+                                        size_t threadCount = 0,
+                                        double maxCost = numeric_limits<double>::infinity()) const {
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        return computeDistancesFrom(*pinned, origin, mode, engine, threadCount, maxCost);
+    }
+    
+    // Sama seperti di atas, atas snapshot yang sudah dipin pemanggil
+    vector<double> computeDistancesFrom(const CSRGraph& csr, const string& origin, const string& mode,
+                                        SsspEngine engine, size_t threadCount, double maxCost) const {
+        vector<double> distances;
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return distances;
+        }
+
+        uint32_t originId = csr.getId(origin);
+        if (originId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Lokasi '" << origin << "' tidak ditemukan." << endl;
+            return distances;
+        }
+
+        const vector<double>& weights = csr.getWeights(column);
+        if (engine == SsspEngine::DELTA_STEPPING) {
+            if (threadCount == 0) threadCount = ThreadPool::defaultThreadCount();
+            ThreadPool pool(threadCount);
+            deltaStepping.run(csr, weights, originId, DeltaStepping::suggestDelta(weights),
+                              &pool, distances, maxCost);
+            return distances;
+        }
+
+        SearchWorkspace& ws = workspace;
+        withColumnPolicy(csr, column, [&](auto weightOf) {
+            return runDijkstra(csr, originId, CSRGraph::INVALID_NODE, SearchLimits(maxCost), ws, weightOf);
+        });
+        distances.assign(csr.getNodeCount(), numeric_limits<double>::infinity());
+        for (uint32_t id : ws.touched) {
+            if (ws.heap.wasPopped(id)) distances[id] = ws.cost[id];
+        }
+        return distances;
+    }
+    
+    // Isochrone: semua lokasi yang bisa dicapai dari origin dengan biaya
+    // <= maxCost, terurut dari yang terdekat
+    vector<pair<string, double>> findReachableWithin(const string& origin, const string& mode, double maxCost,
+                                                     SsspEngine engine = SsspEngine::SEQUENTIAL,
+                                                     size_t threadCount = 0) const {
+        vector<pair<string, double>> reachable;
+        // Jarak dan nama harus dari snapshot yang sama agar ID-nya cocok
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        vector<double> distances = computeDistancesFrom(csr, origin, mode, engine, threadCount, maxCost);
+        for (uint32_t id = 0; id < distances.size(); ++id) {
+            if (distances[id] <= maxCost) reachable.push_back(make_pair(csr.getName(id), distances[id]));
+        }
+        sort(reachable.begin(), reachable.end(),
+            [](const pair<string, double>& a, const pair<string, double>& b) { return a.second < b.second; });
+        return reachable;
+    }
+    
+    // Semua rute Pareto-optimal (waktu, biaya, jarak) dalam satu pencarian.
+    // maxLabels membatasi memori pada graf yang front-nya sangat besar.
+    ParetoFront findParetoRoutes(const string& start, const string& end,
+                                 size_t maxLabels = 5000000) const {
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return ParetoFront();
+        }
+
+        ParetoFront front = paretoSearch.run(csr, startId, endId, maxLabels);
+        if (front.routes.empty()) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+        } else if (front.truncated) {
+            messages() << "⚠️  Batas " << maxLabels << " label tercapai, Pareto front mungkin belum lengkap." << endl;
+        }
+        return front;
+    }
+    
+    // k rute alternatif tanpa loop, terurut dari biaya terkecil (algoritma Yen)
+    vector<PathResult> findKShortestPaths(const string& start, const string& end,
+                                          const string& mode, size_t k) const {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return vector<PathResult>();
+        }
+
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return vector<PathResult>();
+        }
+
+        vector<KShortestPaths::Path> paths = kShortestPaths.run(csr, csr.getWeights(column), startId, endId, k);
+        if (paths.empty()) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+        }
+
+        vector<PathResult> results;
+        results.reserve(paths.size());
+        for (const KShortestPaths::Path& path : paths) {
+            vector<string> names;
+            names.reserve(path.nodes.size());
+            for (uint32_t id : path.nodes) {
+                names.push_back(csr.getName(id));
             }
+            results.push_back(PathResult(names, path.cost));
+        }
+        return results;
+    }
+    
+    // Rute terbaik menurut `mode` dengan syarat total `budgetMode` <= budget,
+    // misalnya rute tercepat yang biayanya tidak lebih dari Rp 500.000.
+    // maxLabels membatasi memori seperti pada findParetoRoutes.
+    PathResult findShortestPathWithBudget(const string& start, const string& end, const string& mode,
+                                          const string& budgetMode, double budget,
+                                          size_t maxLabels = 5000000) const {
+        CSRGraph::WeightColumn column, budgetColumn;
+        if (!CSRGraph::parseMode(mode, column) || !CSRGraph::parseMode(budgetMode, budgetColumn)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return PathResult();
+        }
+
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        vector<uint32_t> ids;
+        double used = 0;
+        size_t settled = 0;
+        bool truncated = false;
+        double cost = constrainedSearch.run(csr, csr.getWeights(column), csr.getWeights(budgetColumn),
+                                            startId, endId, budget, maxLabels, ids, used, settled, truncated);
+        if (truncated) {
+            messages() << "⚠️  Batas " << maxLabels << " label tercapai sebelum rute ditemukan, "
+                 << "rute dengan anggaran ini mungkin tetap ada." << endl;
+            return PathResult();
+        }
+        if (ids.empty()) {
+            messages() << "❌ Tidak ada rute dari " << start << " ke " << end << " dengan total "
+                 << budgetMode << " <= " << fixed << setprecision(1) << budget << endl;
+            return PathResult();
         }
 
-        return reconstructPath(start, end, previous, cost);
+        vector<string> path;
+        path.reserve(ids.size());
+        for (uint32_t id : ids) {
+            path.push_back(csr.getName(id));
+        }
+        return PathResult(path, cost, settled);
     }
     
-    PathResult findBestRouteWithPreference(const string& start, const string& end, 
-                                          const PreferenceManager& pref) const {
-        map<string, double> cost;
-        map<string, string> previous;
-        set<string> visited;
+    // Memantau origin yang sering dipakai (misalnya pusat dispatch): pohon
+    // jalur terpendeknya diperbaiki secara inkremental setiap kali graf
+    // berubah, dan findShortestPath dari origin ini dijawab dari pohon itu
+    bool trackOrigin(const string& origin, const string& mode) {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return false;
+        }
+        if (!graph.hasLocation(origin)) {
+            messages() << "❌ Lokasi '" << origin << "' tidak ditemukan." << endl;
+            return false;
+        }
 
-        auto cmp = [&cost](const string& a, const string& b) {
-            return cost[a] > cost[b];
-        };
-        priority_queue<string, vector<string>, decltype(cmp)> pq(cmp);
+        unique_ptr<DynamicShortestPathTree>& tree = trackedOrigins[QueryCache<PathResult>::makeKey(origin, "", mode)];
+        if (!tree || !tree->isValid()) {
+            tree.reset(new DynamicShortestPathTree(graph, origin, mode, messages(), errors()));
+        }
+        return true;
+    }
+    
+    void untrackOrigin(const string& origin, const string& mode) {
+        trackedOrigins.erase(QueryCache<PathResult>::makeKey(origin, "", mode));
+    }
+    
+    const DynamicShortestPathTree* getTrackedTree(const string& origin, const string& mode) const {
+        auto it = trackedOrigins.find(QueryCache<PathResult>::makeKey(origin, "", mode));
+        return it == trackedOrigins.end() ? nullptr : it->second.get();
+    }
+    
+    CacheStats getCacheStats() const { return resultCache.getStats(); }
+    void setCacheCapacity(size_t capacity) { resultCache.setCapacity(capacity); }
+    void clearCache() { resultCache.clear(); }
+    
+    void setLandmarkCount(size_t count) { landmarkCount = count; }
+    
+    // findShortestPath memakai radix heap jika bobot kolomnya bilangan bulat
+    // non-negatif dan graf punya minimal minNodes node; pada graf kecil
+    // heap 4-ary sama cepat atau lebih cepat (lihat benchmark radix).
+    // Dengan tolerance > 0, bobot pecahan juga dikuantisasi asalkan galat
+    // relatif per edge (dan karena itu per rute) <= tolerance; biaya yang
+    // dilaporkan tetap dihitung dari bobot asli. Rute yang dipilih bisa
+    // berbeda, jadi cache hasil dikosongkan setiap pengaturan ini berubah.
+    void setRadixHeapEnabled(bool enabled) {
+        radixHeapEnabled = enabled;
+        resultCache.clear();
+    }
+    void setRadixHeapMinNodes(size_t minNodes) {
+        radixHeapMinNodes = minNodes;
+        resultCache.clear();
+    }
+    void setQuantizationTolerance(double tolerance) {
+        quantizationTolerance = max(0.0, tolerance);
+        for (QuantizedWeights& weights : quantizedWeights) weights = QuantizedWeights();
+        resultCache.clear();
+    }
+    
+    // Direktori file cache tabel landmark; string kosong menonaktifkan penyimpanan
+    void setLandmarkCacheDirectory(const string& directory) { landmarkDirectory = directory; }
+    
+    // Query menggunakan Contraction Hierarchies. Preprocessing untuk mode
+    // tersebut dijalankan otomatis pada query pertama setelah graf berubah.
+    PathResult findShortestPathCH(const string& start, const string& end,
+                                 const string& mode) const {
+        CSRGraph::WeightColumn column;
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors() << "❌ Mode tidak dikenal!" << endl;
+            return PathResult();
+        }
+
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        const CSRGraph& csr = *pinned;
+        uint32_t startId = csr.getId(start);
+        uint32_t endId = csr.getId(end);
+        if (startId == CSRGraph::INVALID_NODE || endId == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        vector<uint32_t> ids;
+        size_t settled = 0;
+        double cost = getHierarchy(csr, column).query(startId, endId, workspace, reverseWorkspace, ids, settled);
+        if (ids.empty()) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+            return PathResult();
+        }
+
+        vector<string> path;
+        path.reserve(ids.size());
+        for (uint32_t id : ids) {
+            path.push_back(csr.getName(id));
+        }
+        return PathResult(path, cost, settled);
+    }
+    
+    // Menjalankan preprocessing CH untuk ketiga mode sekaligus
+    void prepareContractionHierarchies() const {
+        getHierarchy(CSRGraph::WeightColumn::JARAK);
+        getHierarchy(CSRGraph::WeightColumn::WAKTU);
+        getHierarchy(CSRGraph::WeightColumn::BIAYA);
+    }
+    
+    const ContractionHierarchy& getHierarchy(CSRGraph::WeightColumn column) const {
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        return getHierarchy(*pinned, column);
+    }
+    
+    // Hierarki untuk snapshot yang sudah dipin; query memanggil versi ini
+    // agar hierarki dan snapshot-nya selalu dari versi yang sama
+    const ContractionHierarchy& getHierarchy(const CSRGraph& csr, CSRGraph::WeightColumn column) const {
+        shared_ptr<const ContractionHierarchy>& hierarchy = hierarchies[static_cast<int>(column)];
+        if (!hierarchy || hierarchy->getVersion() != csr.getVersion()) {
+            hierarchy = make_shared<const ContractionHierarchy>(csr, csr.getWeights(column));
+        }
+        return *hierarchy;
+    }
+    
+    // Mengaktifkan Customizable Contraction Hierarchies untuk
+    // findBestRouteWithPreference. Preprocessing topologi dijalankan sekarang
+    // dan hanya diulang jika lokasi/rute ditambah atau dihapus; setiap setelan
+    // preferensi (dan setiap perubahan bobot) cukup menjalankan customization.
+    void prepareCustomizableHierarchy() {
+        customizableEnabled = true;
+        getCustomizableHierarchy();
+    }
+    
+    const CustomizableHierarchy& getCustomizableHierarchy() const {
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        return getCustomizableHierarchy(*pinned);
+    }
+    
+    const CustomizableHierarchy& getCustomizableHierarchy(const CSRGraph& csr) const {
+        if (!customizable || customizable->getTopologyVersion() != csr.getTopologyVersion()) {
+            customizable = make_shared<const CustomizableHierarchy>(csr);
+            customizedMetrics.clear();
+        }
+        return *customizable;
+    }
+    
+    // Bobot CCH untuk satu setelan preferensi, dihitung ulang jika versi graf berubah
+    const CustomizableHierarchy::Metric& getCustomizedMetric(const PreferenceManager& pref) const {
+        shared_ptr<const CSRGraph> pinned = pinQuerySnapshot();
+        return getCustomizedMetric(*pinned, pref);
+    }
+    
+    // Hierarki diperiksa (dan mungkin dibangun ulang) sebelum metrik diambil,
+    // jadi metrik yang dikembalikan tetap valid selama snapshot csr dipakai
+    const CustomizableHierarchy::Metric& getCustomizedMetric(const CSRGraph& csr, const PreferenceManager& pref) const {
+        const CustomizableHierarchy& hierarchy = getCustomizableHierarchy(csr);
+        shared_ptr<const CustomizableHierarchy::Metric>& metric = customizedMetrics[preferenceKey(pref)];
+        if (!metric || metric->version != csr.getVersion()) {
+            const vector<double>& scores = getPreferenceScores(csr, pref);
+            shared_ptr<CustomizableHierarchy::Metric> customized = make_shared<CustomizableHierarchy::Metric>();
+            if (ThreadPool::defaultThreadCount() > 1) {
+                ThreadPool pool;
+                hierarchy.customize(scores, csr.getVersion(), *customized, &pool);
+            } else {
+                hierarchy.customize(scores, csr.getVersion(), *customized);
+            }
+            metric = customized;
+        }
+        return *metric;
+    }
+    
+    // Kolom skor preferensi untuk snapshot saat ini, dihitung sekali per
+    // setelan preferensi dan versi graf
+    const vector<double>& getPreferenceScores(const CSRGraph& csr, const PreferenceManager& pref) const {
+        string key = preferenceKey(pref);
+        auto it = scoreColumns.find(key);
+        if (it != scoreColumns.end() && it->second.first == csr.getVersion()) {
+            return *it->second.second;
+        }
+        if (it == scoreColumns.end() && scoreColumns.size() >= SCORE_COLUMN_CACHE_SIZE) {
+            scoreColumns.clear();
+        }
+
+        shared_ptr<vector<double>> scores = make_shared<vector<double>>();
+        computePreferenceScores(csr, pref, *scores);
+        scoreColumns[key] = make_pair(csr.getVersion(), shared_ptr<const vector<double>>(scores));
+        return *scores;
+    }
+    
+    // Snapshot CSR terbaru untuk instance ini. Referensinya hanya valid
+    // sampai panggilan berikutnya yang bisa mengganti snapshot; query di
+    // dalam kelas ini memegang shared_ptr dari pinQuerySnapshot() sendiri.
+    const CSRGraph& getSnapshot() const {
+        return *pinQuerySnapshot();
+    }
+    
+    // true: query memakai snapshot terakhir yang dipublikasikan writer
+    // (GraphManager::publishSnapshot) tanpa pernah menunggu edit yang sedang
+    // berjalan. false (default): setiap query melihat versi graf terbaru.
+    void setSnapshotIsolation(bool enabled) {
+        snapshotIsolation = enabled;
+        snapshot.reset();
+    }
+    
+    // false: pesan seperti "rute tidak ditemukan" tidak ditulis ke cout/cerr.
+    // Hanya memengaruhi instance ini, jadi worker paralel bisa membungkam
+    // engine masing-masing tanpa menyentuh stream global.
+    void setVerbose(bool enabled) { verbose = enabled; }
+    bool isVerbose() const { return verbose; }
+    
+private:
+    ostream& messages() const { return verbose ? cout : silent; }
+    ostream& errors() const { return verbose ? cerr : silent; }
+    
+    // Snapshot yang dipakai satu query dari awal sampai akhir. Dengan
+    // snapshot isolation yang dibandingkan adalah snapshot yang sudah
+    // dipublikasikan, bukan versi graf milik writer yang bisa sedang
+    // berubah. Snapshot dibagi dengan instance lain lewat GraphManager dan
+    // tetap hidup selama ada shared_ptr yang memegangnya, walaupun writer
+    // sudah mempublikasikan versi baru.
+    shared_ptr<const CSRGraph> pinQuerySnapshot() const {
+        if (snapshotIsolation) {
+            shared_ptr<const CSRGraph> published = graph.pinSnapshot();
+            if (published != snapshot) snapshot = published;
+        } else if (!snapshot || snapshot->getVersion() != graph.getVersion()) {
+            snapshot = graph.getSnapshot();
+        }
+        return snapshot;
+    }
+    
+    // Versi kunci cache harus versi snapshot yang benar-benar dipakai query:
+    // snapshot yang dipin (snapshot isolation) atau versi graf terbaru
+    unsigned long long cacheVersion(const shared_ptr<const CSRGraph>& pinned) const {
+        return pinned ? pinned->getVersion() : graph.getVersion();
+    }
+    
+    static bool isUnbounded(const SearchLimits& limits) {
+        return limits.maxCost == numeric_limits<double>::infinity() &&
+               limits.maxSettledNodes == numeric_limits<size_t>::max();
+    }
+    
+    static string preferenceKey(const PreferenceManager& pref) {
+        ostringstream key;
+        key << "pref_" << fixed << setprecision(6) << pref.getWeightWaktu() << "_"
+            << pref.getWeightBiaya() << "_" << pref.getWeightJarak();
+        return key.str();
+    }
+    
+    PathResult reportCached(const PathResult& cached, const string& start, const string& end) const {
+        if (cached.path.empty()) {
+            messages() << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+        }
+        return cached;
+    }
+    
+    PathResult queryCustomizable(const CSRGraph& csr, uint32_t startId, uint32_t endId,
+                                 const CustomizableHierarchy::Metric& metric) const {
+        vector<uint32_t> ids;
+        size_t settled = 0;
+        double cost = getCustomizableHierarchy(csr).query(metric, startId, endId, customizableWorkspace, ids, settled);
+        if (ids.empty()) {
+            messages() << "❌ Rute tidak ditemukan dari " << csr.getName(startId) << " ke " << csr.getName(endId) << endl;
+            return PathResult();
+        }
 
-        for (const auto& pair : graph.getLocations()) {
-            cost[pair.first] = numeric_limits<double>::infinity();
+        vector<string> path;
+        path.reserve(ids.size());
+        for (uint32_t id : ids) {
+            path.push_back(csr.getName(id));
         }
+        return PathResult(path, cost, settled);
+    }
+    
+    // Inti Dijkstra: heap 4-ary berindeks dengan decrease-key di atas ID node.
+    // Berhenti begitu target di-pop, atau saat batas biaya/jumlah node tercapai.
+    // Mengembalikan jumlah node yang diselesaikan.
+    template <typename WeightPolicy>
+    size_t runDijkstra(const CSRGraph& csr, uint32_t startId, uint32_t targetId,
+                       const SearchLimits& limits, SearchWorkspace& ws,
+                       WeightPolicy weightOf) const {
+        ws.reset(csr.getNodeCount());
+        ws.improve(startId, 0, CSRGraph::INVALID_NODE);
+        size_t settled = 0;
 
-        cost[start] = 0;
-        pq.push(start);
+        while (!ws.heap.empty()) {
+            if (ws.heap.topKey() > limits.maxCost || settled >= limits.maxSettledNodes) break;
 
-        while (!pq.empty()) {
-            string current = pq.top();
-            pq.pop();
+            uint32_t current = ws.heap.pop();
+            double currentCost = ws.cost[current];
+            ++settled;
+            if (current == targetId) break;
 
-            if (visited.count(current)) continue;
-            visited.insert(current);
+            for (uint32_t e = csr.edgeBegin(current); e < csr.edgeEnd(current); ++e) {
+                ws.improve(csr.getTarget(e), currentCost + weightOf(e), current);
+            }
+        }
+        return settled;
+    }
+    
+    const QuantizedWeights* getQuantizedWeights(const CSRGraph& csr, CSRGraph::WeightColumn column) const {
+        if (!radixHeapEnabled || csr.getNodeCount() < radixHeapMinNodes) return nullptr;
+        QuantizedWeights& weights = quantizedWeights[static_cast<int>(column)];
+        if (weights.version != csr.getVersion()) {
+            weights = QuantizedWeights::build(csr.getWeights(column), quantizationTolerance, csr.getVersion());
+        }
+        return weights.usable ? &weights : nullptr;
+    }
+    
+    // Dijkstra dengan radix heap monoton atas key integer. Tanpa decrease-key:
+    // entry basi (key tidak sama dengan key node) dilewati saat di-pop. Jika
+    // bobot hasil kuantisasi tidak tepat, biaya asli diakumulasi terpisah
+    // agar biaya yang dilaporkan tidak terpengaruh pembulatan.
+    size_t runRadixDijkstra(const CSRGraph& csr, uint32_t startId, uint32_t targetId,
+                            const SearchLimits& limits, const QuantizedWeights& integerWeights,
+                            const vector<double>& weights, RadixWorkspace& ws) const {
+        ws.reset(csr.getNodeCount());
+        ws.state[startId].key = 0;
+        ws.cost[startId] = 0;
+        ws.touched.push_back(startId);
+        ws.heap.push(0, startId);
+        const uint64_t* values = integerWeights.values.data();
+        RadixWorkspace::NodeState* state = ws.state.data();
+        bool exact = integerWeights.exact;
+        size_t settled = 0;
 
-            for (const auto& route : graph.getRoutesFrom(current)) {
-                string neighbor = route.getDestination();
+        while (!ws.heap.empty() && settled < limits.maxSettledNodes) {
+            RadixHeap::Entry entry = ws.heap.pop();
+            uint32_t current = entry.second;
+            if (entry.first != state[current].key) continue;
 
-                double skor = pref.calculateScore(route.getTime(), route.getCost(), route.getDistance());
+            double currentCost = exact ? entry.first / integerWeights.scale : ws.cost[current];
+            if (currentCost > limits.maxCost) break;
+            ws.cost[current] = currentCost;
+            state[current].settled = 1;
+            ++settled;
+            if (current == targetId) break;
 
-                double newCost = cost[current] + skor;
-                if (newCost < cost[neighbor]) {
-                    cost[neighbor] = newCost;
-                    previous[neighbor] = current;
-                    pq.push(neighbor);
+            for (uint32_t e = csr.edgeBegin(current); e < csr.edgeEnd(current); ++e) {
+                uint32_t next = csr.getTarget(e);
+                uint64_t newKey = entry.first + values[e];
+                if (newKey < state[next].key) {
+                    if (state[next].key == numeric_limits<uint64_t>::max()) ws.touched.push_back(next);
+                    state[next].key = newKey;
+                    state[next].previous = current;
+                    if (!exact) ws.cost[next] = currentCost + weights[e];
+                    ws.heap.push(newKey, next);
                 }
             }
         }
+        return settled;
+    }
+    
+    void fillMatrixRow(const CSRGraph& csr, const vector<double>& weights, uint32_t sourceId,
+                       const vector<uint32_t>& targetIds, const vector<char>& isTarget,
+                       size_t uniqueTargets, SearchWorkspace& ws, double* row) const {
+        ws.reset(csr.getNodeCount());
+        ws.improve(sourceId, 0, CSRGraph::INVALID_NODE);
+        size_t remaining = uniqueTargets;
+
+        while (!ws.heap.empty() && remaining > 0) {
+            uint32_t current = ws.heap.pop();
+            if (isTarget[current]) --remaining;
 
-        return reconstructPath(start, end, previous, cost);
+            double currentCost = ws.cost[current];
+            for (uint32_t e = csr.edgeBegin(current); e < csr.edgeEnd(current); ++e) {
+                ws.improve(csr.getTarget(e), currentCost + weights[e], current);
+            }
+        }
+
+        for (size_t j = 0; j < targetIds.size(); ++j) {
+            if (targetIds[j] != CSRGraph::INVALID_NODE && ws.heap.wasPopped(targetIds[j])) {
+                row[j] = ws.cost[targetIds[j]];
+            }
+        }
     }
     
-private:
-    PathResult reconstructPath(const string& start, const string& end,
-                              const map<string, string>& previous,
-                              const map<string, double>& cost) const {
+    // Inti A*: key heap = biaya + heuristik. Heuristik harus konsisten agar
+    // node yang sudah di-pop tidak perlu dibuka ulang.
+    template <typename WeightPolicy, typename HeuristicFn>
+    PathResult runAStar(const CSRGraph& csr, uint32_t startId, uint32_t endId,
+                        WeightPolicy weightOf, HeuristicFn heuristic) const {
+        SearchWorkspace& ws = workspace;
+        ws.reset(csr.getNodeCount());
+        ws.improve(startId, 0, CSRGraph::INVALID_NODE, heuristic(startId));
+        size_t settled = 0;
+
+        while (!ws.heap.empty()) {
+            uint32_t current = ws.heap.pop();
+            ++settled;
+            if (current == endId) break;
+
+            double currentCost = ws.cost[current];
+            for (uint32_t e = csr.edgeBegin(current); e < csr.edgeEnd(current); ++e) {
+                uint32_t neighbor = csr.getTarget(e);
+                double newCost = currentCost + weightOf(e);
+                if (newCost < ws.cost[neighbor]) {
+                    double estimate = heuristic(neighbor);
+                    if (estimate == numeric_limits<double>::infinity()) continue;
+                    ws.improve(neighbor, newCost, current, newCost + estimate);
+                }
+            }
+        }
+
+        return reconstructPath(csr, startId, endId, ws, settled);
+    }
+    
+    // Tabel landmark dimuat dari file cache jika cocok dengan graf saat ini,
+    // jika tidak dihitung ulang (paralel per landmark) lalu disimpan
+    const LandmarkIndex& getLandmarkIndex(const CSRGraph& csr, const string& key,
+                                          const vector<double>& weights) const {
+        auto& entry = landmarkIndexes[key];
+        if (entry.second && entry.first == csr.getVersion()) {
+            return *entry.second;
+        }
+
+        uint64_t fingerprint = LandmarkIndex::computeFingerprint(csr, weights);
+        if (entry.second && entry.second->getFingerprint() == fingerprint) {
+            entry.first = csr.getVersion();
+            return *entry.second;
+        }
+
+        string filename = landmarkDirectory.empty() ? "" : landmarkDirectory + "/landmarks_" + key + ".alt";
+        shared_ptr<LandmarkIndex> index = make_shared<LandmarkIndex>();
+        if (filename.empty() || !index->loadFromFile(filename, fingerprint, csr.getNodeCount())) {
+            index = make_shared<LandmarkIndex>(csr, weights, landmarkCount);
+            if (!filename.empty() && !index->saveToFile(filename)) {
+                errors() << "⚠️  Gagal menyimpan tabel landmark ke " << filename << endl;
+            }
+        }
+
+        entry = { csr.getVersion(), index };
+        return *index;
+    }
+    
+    // Berhenti saat topMaju + topMundur >= biaya jalur terbaik yang sudah
+    // ditemukan (mu); setelah itu tidak ada jalur lain yang bisa lebih murah.
+    template <typename WeightPolicy>
+    PathResult runBidirectional(const CSRGraph& csr, uint32_t startId, uint32_t endId,
+                                WeightPolicy weightOf) const {
+        SearchWorkspace& fw = workspace;
+        SearchWorkspace& bw = reverseWorkspace;
+        fw.reset(csr.getNodeCount());
+        bw.reset(csr.getNodeCount());
+        fw.improve(startId, 0, CSRGraph::INVALID_NODE);
+        bw.improve(endId, 0, CSRGraph::INVALID_NODE);
+
+        double best = startId == endId ? 0 : numeric_limits<double>::infinity();
+        uint32_t meeting = startId == endId ? startId : CSRGraph::INVALID_NODE;
+        size_t settled = 0;
+
+        while (!fw.heap.empty() && !bw.heap.empty()) {
+            if (fw.heap.topKey() + bw.heap.topKey() >= best) break;
+
+            if (fw.heap.topKey() <= bw.heap.topKey()) {
+                uint32_t u = fw.heap.pop();
+                ++settled;
+                for (uint32_t e = csr.edgeBegin(u); e < csr.edgeEnd(u); ++e) {
+                    uint32_t v = csr.getTarget(e);
+                    double candidate = fw.cost[u] + weightOf(e);
+                    fw.improve(v, candidate, u);
+                    if (candidate + bw.cost[v] < best) {
+                        best = candidate + bw.cost[v];
+                        meeting = v;
+                    }
+                }
+            } else {
+                uint32_t u = bw.heap.pop();
+                ++settled;
+                for (uint32_t slot = csr.reverseBegin(u); slot < csr.reverseEnd(u); ++slot) {
+                    uint32_t v = csr.getReverseSource(slot);
+                    double candidate = bw.cost[u] + weightOf(csr.getReverseEdge(slot));
+                    bw.improve(v, candidate, u);
+                    if (candidate + fw.cost[v] < best) {
+                        best = candidate + fw.cost[v];
+                        meeting = v;
+                    }
+                }
+            }
+        }
+
+        if (meeting == CSRGraph::INVALID_NODE) {
+            messages() << "❌ Rute tidak ditemukan dari " << csr.getName(startId) << " ke " << csr.getName(endId) << endl;
+            return PathResult();
+        }
+
+        vector<string> path;
+        for (uint32_t id = meeting; id != CSRGraph::INVALID_NODE; id = fw.previous[id]) {
+            path.push_back(csr.getName(id));
+        }
+        reverse(path.begin(), path.end());
+        for (uint32_t id = bw.previous[meeting]; id != CSRGraph::INVALID_NODE; id = bw.previous[id]) {
+            path.push_back(csr.getName(id));
+        }
+        return PathResult(path, best, settled);
+    }
+    
+    template <typename Workspace>
+    PathResult reconstructPath(const CSRGraph& csr, uint32_t startId, uint32_t endId,
+                              const Workspace& ws, size_t settled) const {
+        // Hanya node yang sudah di-pop yang biayanya pasti optimal
+        if (!ws.isSettled(endId)) {
+            messages() << "❌ Rute tidak ditemukan dari " << csr.getName(startId) << " ke " << csr.getName(endId) << endl;
+            return PathResult();
+        }
+        
         vector<string> path;
-        string temp = end;
+        uint32_t temp = endId;
         
-        while (temp != start && previous.find(temp) != previous.end()) {
-            path.push_back(temp);
-            temp = previous.at(temp);
+        while (temp != startId && ws.previousOf(temp) != CSRGraph::INVALID_NODE) {
+            path.push_back(csr.getName(temp));
+            temp = ws.previousOf(temp);
         }
 
-        if (temp == start) {
-            path.push_back(start);
+        if (temp == startId) {
+            path.push_back(csr.getName(startId));
             reverse(path.begin(), path.end());
-            return PathResult(path, cost.at(end));
+            return PathResult(path, ws.cost[endId], settled);
         }
 
-        cout << "❌ Rute tidak ditemukan dari " << start << " ke " << end << endl;
+        messages() << "❌ Rute tidak ditemukan dari " << csr.getName(startId) << " ke " << csr.getName(endId) << endl;
         return PathResult();
     }
 };
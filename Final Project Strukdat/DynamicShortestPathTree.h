@@ -0,0 +1,340 @@
+#ifndef DYNAMIC_SHORTEST_PATH_TREE_H
+#define DYNAMIC_SHORTEST_PATH_TREE_H
+
+#include "GraphManager.h"
+#include "GraphObserver.h"
+#include "CSRGraph.h"
+#include "IndexedHeap.h"
+#include <vector>
+#include <string>
+#include <queue>
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Pohon jalur terpendek dari satu origin yang diperbaiki secara inkremental
+// saat graf berubah (gaya Ramalingam-Reps), sehingga pusat dispatch tidak
+// perlu menjalankan Dijkstra penuh setiap kali ada update lalu lintas.
+//
+// - Bobot turun / rute baru: hanya node yang jaraknya membaik yang
+//   dipropagasi dengan heap, mulai dari ujung edge tersebut.
+// - Bobot naik / rute dihapus: jika edge termasuk pohon, kandidat node
+//   terdampak diproses urut jarak lama. Node yang masih punya edge masuk
+//   "ketat" (dist[y] + w == dist[x]) dari node tak terdampak tetap pada
+//   jaraknya dan cukup ganti parent. Sisanya dihitung ulang dengan Dijkstra
+//   yang hanya menyentuh himpunan terdampak.
+//
+// Struktur ini menyimpan adjacency sendiri (ID integer) karena snapshot CSR
+// tidak bisa diubah dan membangunnya ulang per update sama mahalnya dengan
+// Dijkstra penuh.
+class DynamicShortestPathTree : public GraphObserver {
+private:
+    struct Arc {
+        uint32_t node;
+        double weight;
+    };
+
+    const GraphManager& graph;
+    CSRGraph::WeightColumn column;
+    string originName;
+    uint32_t origin;
+
+    unordered_map<string, uint32_t> nameToId;
+    vector<string> names;
+    vector<char> removed;
+    vector<vector<Arc>> outArcs;
+    vector<vector<Arc>> inArcs;
+
+    vector<double> dist;
+    vector<uint32_t> parent;
+    IndexedDaryHeap<4> heap;
+    vector<char> affected;
+    size_t lastRepairTouched;
+
+    double weightOf(const Route& route) const {
+        switch (column) {
+            case CSRGraph::WeightColumn::WAKTU: return route.getTime();
+            case CSRGraph::WeightColumn::BIAYA: return route.getCost();
+            case CSRGraph::WeightColumn::JARAK:
+            default: return route.getDistance();
+        }
+    }
+
+    uint32_t addNode(const string& name) {
+        uint32_t id = static_cast<uint32_t>(names.size());
+        nameToId[name] = id;
+        names.push_back(name);
+        removed.push_back(0);
+        outArcs.emplace_back();
+        inArcs.emplace_back();
+        dist.push_back(numeric_limits<double>::infinity());
+        parent.push_back(CSRGraph::INVALID_NODE);
+        affected.push_back(0);
+        return id;
+    }
+
+    uint32_t idOf(const string& name) const {
+        auto it = nameToId.find(name);
+        return it == nameToId.end() ? CSRGraph::INVALID_NODE : it->second;
+    }
+
+    static Arc* findArc(vector<Arc>& arcs, uint32_t node) {
+        for (Arc& arc : arcs) {
+            if (arc.node == node) return &arc;
+        }
+        return nullptr;
+    }
+
+    static void eraseArc(vector<Arc>& arcs, uint32_t node) {
+        arcs.erase(remove_if(arcs.begin(), arcs.end(),
+            [node](const Arc& arc) { return arc.node == node; }), arcs.end());
+    }
+
+    // Dijkstra dari node-node yang sudah ada di heap; hanya melanjutkan ke
+    // tetangga yang jaraknya benar-benar membaik
+    void propagate() {
+        while (!heap.empty()) {
+            uint32_t u = heap.pop();
+            ++lastRepairTouched;
+            for (const Arc& arc : outArcs[u]) {
+                double candidate = dist[u] + arc.weight;
+                if (candidate < dist[arc.node]) {
+                    dist[arc.node] = candidate;
+                    parent[arc.node] = u;
+                    heap.pushOrDecrease(arc.node, candidate);
+                }
+            }
+        }
+    }
+
+    void relaxDecrease(uint32_t u, uint32_t v, double weight) {
+        if (dist[u] + weight >= dist[v]) return;
+        heap.reset(names.size());
+        dist[v] = dist[u] + weight;
+        parent[v] = u;
+        heap.pushOrDecrease(v, dist[v]);
+        propagate();
+    }
+
+    // Perbaikan setelah jarak sebagian node mungkin naik. roots adalah node
+    // yang parent-edge-nya baru saja hilang atau menjadi lebih mahal.
+    void repairIncrease(const vector<uint32_t>& roots) {
+        typedef pair<double, uint32_t> Candidate;
+        priority_queue<Candidate, vector<Candidate>, greater<Candidate>> candidates;
+        for (uint32_t root : roots) {
+            candidates.push(make_pair(dist[root], root));
+        }
+
+        // Fase 1: tentukan node terdampak, urut jarak lama sehingga semua
+        // pendahulu ketat sudah diklasifikasi lebih dulu
+        vector<uint32_t> affectedNodes;
+        while (!candidates.empty()) {
+            uint32_t x = candidates.top().second;
+            candidates.pop();
+            if (affected[x] || x == origin) continue;
+
+            uint32_t support = CSRGraph::INVALID_NODE;
+            if (!removed[x]) {
+                for (const Arc& arc : inArcs[x]) {
+                    // Edge berbobot nol dilewati agar tidak memilih pendukung
+                    // yang ternyata keturunan x sendiri
+                    if (!affected[arc.node] && arc.weight > 0 && dist[arc.node] + arc.weight == dist[x]) {
+                        support = arc.node;
+                        break;
+                    }
+                }
+            }
+            if (support != CSRGraph::INVALID_NODE) {
+                parent[x] = support;
+                continue;
+            }
+
+            affected[x] = 1;
+            affectedNodes.push_back(x);
+            ++lastRepairTouched;
+            for (const Arc& arc : outArcs[x]) {
+                if (parent[arc.node] == x) candidates.push(make_pair(dist[arc.node], arc.node));
+            }
+        }
+
+        // Fase 2: hitung ulang jarak node terdampak dari tetangga yang tidak terdampak
+        heap.reset(names.size());
+        for (uint32_t x : affectedNodes) {
+            dist[x] = numeric_limits<double>::infinity();
+            parent[x] = CSRGraph::INVALID_NODE;
+        }
+        for (uint32_t x : affectedNodes) {
+            affected[x] = 0;
+            if (removed[x]) continue;
+            for (const Arc& arc : inArcs[x]) {
+                double candidate = dist[arc.node] + arc.weight;
+                if (candidate < dist[x]) {
+                    dist[x] = candidate;
+                    parent[x] = arc.node;
+                }
+            }
+            if (dist[x] != numeric_limits<double>::infinity()) heap.pushOrDecrease(x, dist[x]);
+        }
+        propagate();
+    }
+
+public:
+    // Pesan kesalahan ditulis ke messages/errors milik pemanggil, sehingga
+    // pemanggil yang dibungkam (DijkstraAlgorithm::setVerbose) tetap diam
+    DynamicShortestPathTree(const GraphManager& graph, const string& originName, const string& mode,
+                            ostream& messages = cout, ostream& errors = cerr)
+        : graph(graph), column(CSRGraph::WeightColumn::JARAK), originName(originName),
+          origin(CSRGraph::INVALID_NODE),
+          lastRepairTouched(0) {
+        if (!CSRGraph::parseMode(mode, column)) {
+            errors << "❌ Mode tidak dikenal!" << endl;
+        }
+
+        for (const auto& pair : graph.getLocations()) {
+            addNode(pair.first);
+        }
+        for (uint32_t id = 0; id < names.size(); ++id) {
+            for (const Route& route : graph.getRoutesFrom(names[id])) {
+                uint32_t target = nameToId.at(route.getDestination());
+                double weight = weightOf(route);
+                outArcs[id].push_back({ target, weight });
+                inArcs[target].push_back({ id, weight });
+            }
+        }
+
+        origin = idOf(originName);
+        if (origin == CSRGraph::INVALID_NODE) {
+            messages << "❌ Lokasi '" << originName << "' tidak ditemukan." << endl;
+        } else {
+            recompute();
+        }
+        graph.addObserver(this);
+    }
+
+    DynamicShortestPathTree(const DynamicShortestPathTree&) = delete;
+    DynamicShortestPathTree& operator=(const DynamicShortestPathTree&) = delete;
+
+    virtual ~DynamicShortestPathTree() {
+        graph.removeObserver(this);
+    }
+
+    // Dijkstra penuh dari origin (dipakai saat inisialisasi dan sebagai pembanding)
+    void recompute() {
+        fill(dist.begin(), dist.end(), numeric_limits<double>::infinity());
+        fill(parent.begin(), parent.end(), CSRGraph::INVALID_NODE);
+        if (origin == CSRGraph::INVALID_NODE || removed[origin]) return;
+
+        lastRepairTouched = 0;
+        heap.reset(names.size());
+        dist[origin] = 0;
+        heap.pushOrDecrease(origin, 0);
+        propagate();
+    }
+
+    void onLocationAdded(const string& name) override {
+        addNode(name);
+        lastRepairTouched = 0;
+    }
+
+    void onLocationRemoved(const string& name) override {
+        uint32_t id = idOf(name);
+        if (id == CSRGraph::INVALID_NODE) return;
+        lastRepairTouched = 0;
+
+        vector<uint32_t> roots;
+        if (parent[id] != CSRGraph::INVALID_NODE || id == origin) roots.push_back(id);
+        for (const Arc& arc : outArcs[id]) {
+            eraseArc(inArcs[arc.node], id);
+            if (parent[arc.node] == id) roots.push_back(arc.node);
+        }
+        for (const Arc& arc : inArcs[id]) {
+            eraseArc(outArcs[arc.node], id);
+        }
+        outArcs[id].clear();
+        inArcs[id].clear();
+        removed[id] = 1;
+        nameToId.erase(name);
+
+        if (id == origin) {
+            fill(dist.begin(), dist.end(), numeric_limits<double>::infinity());
+            fill(parent.begin(), parent.end(), CSRGraph::INVALID_NODE);
+            return;
+        }
+        repairIncrease(roots);
+    }
+
+    void onRouteAdded(const Route& route) override {
+        uint32_t u = idOf(route.getSource());
+        uint32_t v = idOf(route.getDestination());
+        if (u == CSRGraph::INVALID_NODE || v == CSRGraph::INVALID_NODE) return;
+        lastRepairTouched = 0;
+
+        double weight = weightOf(route);
+        outArcs[u].push_back({ v, weight });
+        inArcs[v].push_back({ u, weight });
+        relaxDecrease(u, v, weight);
+    }
+
+    void onRouteRemoved(const string& sourceName, const string& destName) override {
+        uint32_t u = idOf(sourceName);
+        uint32_t v = idOf(destName);
+        if (u == CSRGraph::INVALID_NODE || v == CSRGraph::INVALID_NODE) return;
+        lastRepairTouched = 0;
+
+        eraseArc(outArcs[u], v);
+        eraseArc(inArcs[v], u);
+        if (parent[v] == u) repairIncrease(vector<uint32_t>(1, v));
+    }
+
+    void onRouteUpdated(const Route& route) override {
+        uint32_t u = idOf(route.getSource());
+        uint32_t v = idOf(route.getDestination());
+        if (u == CSRGraph::INVALID_NODE || v == CSRGraph::INVALID_NODE) return;
+        lastRepairTouched = 0;
+
+        Arc* out = findArc(outArcs[u], v);
+        Arc* in = findArc(inArcs[v], u);
+        if (out == nullptr || in == nullptr) return;
+
+        double oldWeight = out->weight;
+        double newWeight = weightOf(route);
+        out->weight = newWeight;
+        in->weight = newWeight;
+
+        if (newWeight < oldWeight) {
+            relaxDecrease(u, v, newWeight);
+        } else if (newWeight > oldWeight && parent[v] == u) {
+            repairIncrease(vector<uint32_t>(1, v));
+        }
+    }
+
+    bool isValid() const { return origin != CSRGraph::INVALID_NODE && !removed[origin]; }
+    const string& getOrigin() const { return originName; }
+    CSRGraph::WeightColumn getColumn() const { return column; }
+
+    // Jumlah node yang diproses perbaikan terakhir
+    size_t getLastRepairTouched() const { return lastRepairTouched; }
+
+    double getDistance(const string& target) const {
+        uint32_t id = idOf(target);
+        return id == CSRGraph::INVALID_NODE ? numeric_limits<double>::infinity() : dist[id];
+    }
+
+    // Jalur dari origin ke target; kosong jika tidak terjangkau
+    vector<string> getPath(const string& target) const {
+        vector<string> path;
+        uint32_t id = idOf(target);
+        if (id == CSRGraph::INVALID_NODE || dist[id] == numeric_limits<double>::infinity()) return path;
+
+        for (uint32_t at = id; at != CSRGraph::INVALID_NODE; at = parent[at]) {
+            path.push_back(names[at]);
+        }
+        reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+#endif
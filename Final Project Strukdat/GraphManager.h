@@ -3,27 +3,71 @@
 
 #include "Location.h"
 #include "Route.h"
+#include "CSRGraph.h"
+#include "GraphObserver.h"
+#include "ThreadPool.h"
 #include <vector>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 using namespace std;
 
 class GraphManager {
 private:
     unordered_map<string, Location> locations;
     unordered_map<string, vector<Route>> adjacencyList;
+    atomic<unsigned long long> version;  // Naik setiap kali graf berubah
+    // Observer bukan bagian dari isi graf, jadi boleh didaftarkan lewat referensi const
+    mutable vector<GraphObserver*> observers;
+
+    // Writer (semua fungsi pengubah graf) saling eksklusif lewat writerMutex.
+    // Reader di thread lain tidak membaca adjacencyList sama sekali: mereka
+    // memakai snapshot CSR immutable yang dipublikasikan lewat atomic_load /
+    // atomic_store pada shared_ptr. Snapshot lama dibebaskan otomatis saat
+    // reader terakhir yang memegangnya selesai.
+    mutable mutex writerMutex;
+    mutable shared_ptr<const CSRGraph> published;
+
+    // Perubahan sejak snapshot terakhir dipublikasikan. Jika hanya bobot yang
+    // berubah, snapshot baru cukup berupa salinan yang ditambal.
+    mutable vector<Route> pendingWeightUpdates;
+    mutable bool topologyChanged;
+
+    void markTopologyChanged() {
+        topologyChanged = true;
+        pendingWeightUpdates.clear();
+    }
+
+    shared_ptr<const CSRGraph> publishLocked() const {
+        shared_ptr<const CSRGraph> current = atomic_load(&published);
+        if (current && current->getVersion() == version) return current;
+
+        if (current && !topologyChanged) {
+            current = make_shared<const CSRGraph>(*current, pendingWeightUpdates, version);
+        } else {
+            current = make_shared<const CSRGraph>(locations, adjacencyList, version);
+        }
+        pendingWeightUpdates.clear();
+        topologyChanged = false;
+        atomic_store(&published, current);
+        return current;
+    }
 
 public:
-    GraphManager() = default;
+    GraphManager() : version(0), topologyChanged(false) {}
     virtual ~GraphManager() = default;
     
     bool addLocation(const string& name, double x, double y) {
+        lock_guard<mutex> lock(writerMutex);
         if (locations.find(name) != locations.end()) {
             cout << "❌ Lokasi '" << name << "' sudah ada." << endl;
             return false;
@@ -31,11 +75,15 @@ public:
         
         locations.emplace(name, Location(name, x, y));
         adjacencyList[name] = vector<Route>();
+        markTopologyChanged();
+        ++version;
+        for (GraphObserver* observer : observers) observer->onLocationAdded(name);
         cout << "✅ Lokasi '" << name << "' di koordinat (" << x << ", " << y << ") berhasil ditambahkan." << endl;
         return true;
     }
     
     bool removeLocation(const string& name) {
+        lock_guard<mutex> lock(writerMutex);
         if (locations.find(name) == locations.end()) {
             cout << "❌ Lokasi '" << name << "' tidak ditemukan." << endl;
             return false;
@@ -51,6 +99,9 @@ public:
                     return route.getDestination() == name;
                 }), routes.end());
         }
+        markTopologyChanged();
+        ++version;
+        for (GraphObserver* observer : observers) observer->onLocationRemoved(name);
         
         cout << "✅ Lokasi '" << name << "' berhasil dihapus." << endl;
         return true;
@@ -58,6 +109,7 @@ public:
     
     bool addRoute(const string& sourceName, const string& destName,
                   double time, double cost) {
+        lock_guard<mutex> lock(writerMutex);
         if (locations.find(sourceName) == locations.end() || 
             locations.find(destName) == locations.end()) {
             cout << "❌ Lokasi asal atau tujuan tidak ditemukan." << endl;
@@ -74,6 +126,9 @@ public:
         double distance = locations.at(sourceName).distanceTo(locations.at(destName));
         
         adjacencyList[sourceName].emplace_back(sourceName, destName, distance, time, cost);
+        markTopologyChanged();
+        ++version;
+        for (GraphObserver* observer : observers) observer->onRouteAdded(adjacencyList[sourceName].back());
         cout << "✅ Rute dari '" << sourceName << "' ke '" << destName << "' berhasil ditambahkan." << endl;
         cout << "📏 Jarak otomatis: " << fixed << setprecision(1) << distance << " km" << endl;
         return true;
@@ -94,7 +149,104 @@ public:
         return false;
     }
     
+    // Menambah banyak rute sekaligus di bawah satu kunci writer dan satu
+    // kenaikan versi, tanpa output per rute. Rute yang lokasinya tidak ada
+    // atau sudah ada (di graf maupun lebih awal di batch) dilewati. Waktu
+    // dan biaya diambil dari Route, tetapi jarak selalu dihitung ulang dari
+    // koordinat seperti addRoute, karena heuristik A* (CSRGraph) menganggap
+    // jarak rute sama dengan jarak garis lurus. Mengembalikan jumlah rute
+    // yang benar-benar ditambahkan. Dengan pool, pencarian lokasi dan
+    // perhitungan jarak (hanya membaca) dibagi ke beberapa thread;
+    // penambahan ke daftar rute tetap berurutan sesuai input.
+    size_t addRoutesBulk(const vector<Route>& routes, ThreadPool* pool = nullptr) {
+        lock_guard<mutex> lock(writerMutex);
+
+        // Daftar rute asal per rute; nullptr jika asal atau tujuan tidak ada
+        vector<vector<Route>*> resolved(routes.size());
+        vector<double> distances(routes.size());
+        auto resolve = [&](size_t first, size_t last) {
+            // Batch yang terurut menurut asal cukup mencari asal sekali per kelompok
+            string sourceName;
+            vector<Route>* sourceRoutes = nullptr;
+            const Location* source = nullptr;
+            for (size_t i = first; i < last; ++i) {
+                if (i == first || routes[i].getSource() != sourceName) {
+                    sourceName = routes[i].getSource();
+                    auto list = adjacencyList.find(sourceName);
+                    auto location = locations.find(sourceName);
+                    bool known = list != adjacencyList.end() && location != locations.end();
+                    sourceRoutes = known ? &list->second : nullptr;
+                    source = known ? &location->second : nullptr;
+                }
+                auto dest = locations.find(routes[i].getDestination());
+                if (sourceRoutes == nullptr || dest == locations.end()) {
+                    resolved[i] = nullptr;
+                    continue;
+                }
+                resolved[i] = sourceRoutes;
+                distances[i] = source->distanceTo(dest->second);
+            }
+        };
+
+        size_t chunks = pool != nullptr && pool->size() > 1 ? min(routes.size(), pool->size() * 4) : 1;
+        if (chunks <= 1) {
+            resolve(0, routes.size());
+        } else {
+            for (size_t chunk = 0; chunk < chunks; ++chunk) {
+                size_t first = routes.size() * chunk / chunks;
+                size_t last = routes.size() * (chunk + 1) / chunks;
+                pool->submit([&resolve, first, last]() { resolve(first, last); });
+            }
+            pool->wait();
+        }
+
+        // Daftar rute yang panjang dicek lewat set tujuan agar batch besar ke
+        // satu lokasi tidak menjadi kuadratik
+        const size_t LINEAR_SCAN_LIMIT = 16;
+        unordered_map<const vector<Route>*, unordered_set<string>> destinationsOf;
+        vector<Route> added;
+        size_t addedCount = 0;
+
+        for (size_t i = 0; i < routes.size(); ++i) {
+            vector<Route>* existing = resolved[i];
+            if (existing == nullptr) continue;
+            const Route& route = routes[i];
+            string destName = route.getDestination();
+
+            if (existing->size() < LINEAR_SCAN_LIMIT) {
+                bool duplicate = false;
+                for (const Route& r : *existing) {
+                    if (r.getDestination() == destName) {
+                        duplicate = true;
+                        break;
+                    }
+                }
+                if (duplicate) continue;
+            } else {
+                auto known = destinationsOf.find(existing);
+                if (known == destinationsOf.end()) {
+                    known = destinationsOf.emplace(existing, unordered_set<string>()).first;
+                    for (const Route& r : *existing) known->second.insert(r.getDestination());
+                }
+                if (!known->second.insert(destName).second) continue;
+            }
+
+            existing->emplace_back(route.getSource(), destName, distances[i], route.getTime(), route.getCost());
+            if (!observers.empty()) added.push_back(existing->back());
+            ++addedCount;
+        }
+
+        if (addedCount == 0) return 0;
+        markTopologyChanged();
+        ++version;
+        for (const Route& route : added) {
+            for (GraphObserver* observer : observers) observer->onRouteAdded(route);
+        }
+        return addedCount;
+    }
+    
     bool removeRoute(const string& sourceName, const string& destName) {
+        lock_guard<mutex> lock(writerMutex);
         if (adjacencyList.find(sourceName) == adjacencyList.end()) {
             cout << "❌ Lokasi asal tidak ditemukan." << endl;
             return false;
@@ -112,12 +264,16 @@ public:
         }
         
         routes.erase(it, routes.end());
+        markTopologyChanged();
+        ++version;
+        for (GraphObserver* observer : observers) observer->onRouteRemoved(sourceName, destName);
         cout << "✅ Rute dari '" << sourceName << "' ke '" << destName << "' berhasil dihapus." << endl;
         return true;
     }
     
     bool updateRoute(const string& sourceName, const string& destName,
                      double newTime, double newCost) {
+        lock_guard<mutex> lock(writerMutex);
         if (adjacencyList.find(sourceName) == adjacencyList.end()) {
             cout << "❌ Lokasi asal tidak ditemukan." << endl;
             return false;
@@ -128,6 +284,13 @@ public:
             if (route.getDestination() == destName) {
                 route.setTime(newTime);
                 route.setCost(newCost);
+                // Tambalan dibatasi; lebih dari ini membangun ulang lebih murah
+                if (!topologyChanged) {
+                    pendingWeightUpdates.push_back(route);
+                    if (pendingWeightUpdates.size() > locations.size()) markTopologyChanged();
+                }
+                ++version;
+                for (GraphObserver* observer : observers) observer->onRouteUpdated(route);
                 cout << "✅ Rute berhasil diperbarui." << endl;
                 return true;
             }
@@ -229,6 +392,47 @@ public:
         return true;
     }
     
+    // Format per baris: asal,tujuan,waktu,biaya atau asal,tujuan,jarak,waktu,biaya
+    // (format ekspor VisualizationManager). Jarak selalu dihitung ulang dari
+    // koordinat seperti pada addRoute.
+    bool loadRoutesFromCSV(const string& filename) {
+        ifstream file(filename);
+        if (!file.is_open()) {
+            cout << "❌ Gagal membuka file: " << filename << endl;
+            return false;
+        }
+
+        string line;
+        cout << "📂 Memuat rute dari " << filename << "..." << endl;
+        
+        while (getline(file, line)) {
+            if (line.empty()) continue;
+            
+            stringstream ss(line);
+            vector<string> fields;
+            string field;
+            while (getline(ss, field, ',')) {
+                fields.push_back(field);
+            }
+            
+            try {
+                if (fields.size() == 4) {
+                    addRoute(fields[0], fields[1], stod(fields[2]), stod(fields[3]));
+                } else if (fields.size() == 5) {
+                    addRoute(fields[0], fields[1], stod(fields[3]), stod(fields[4]));
+                } else {
+                    cerr << "❌ Error parsing line: " << line << endl;
+                }
+            } catch (const exception& e) {
+                cerr << "❌ Error parsing line: " << line << endl;
+            }
+        }
+        
+        file.close();
+        cout << "✅ Rute berhasil dimuat dari file!" << endl;
+        return true;
+    }
+    
     void saveLocationsToCSV(const string& filename) const {
         ofstream file(filename);
         if (!file.is_open()) {
@@ -252,6 +456,51 @@ public:
     bool hasLocation(const string& name) const {
         return locations.find(name) != locations.end();
     }
+    
+    unsigned long long getVersion() const {
+        return version;
+    }
+    
+    void addObserver(GraphObserver* observer) const {
+        lock_guard<mutex> lock(writerMutex);
+        observers.push_back(observer);
+    }
+    
+    void removeObserver(GraphObserver* observer) const {
+        lock_guard<mutex> lock(writerMutex);
+        observers.erase(remove(observers.begin(), observers.end(), observer), observers.end());
+    }
+    
+    // Membekukan graf saat ini menjadi snapshot CSR untuk pencarian rute
+    CSRGraph freeze() const {
+        lock_guard<mutex> lock(writerMutex);
+        return CSRGraph(locations, adjacencyList, version);
+    }
+    
+    // Snapshot yang pasti sesuai versi graf saat ini; dibangun dan
+    // dipublikasikan jika belum ada (menunggu writer yang sedang berjalan)
+    shared_ptr<const CSRGraph> getSnapshot() const {
+        shared_ptr<const CSRGraph> current = atomic_load(&published);
+        if (current && current->getVersion() == version) return current;
+
+        lock_guard<mutex> lock(writerMutex);
+        return publishLocked();
+    }
+    
+    // Snapshot terakhir yang sudah dipublikasikan, tanpa menunggu writer.
+    // Bisa tertinggal beberapa versi; hanya membangun snapshot jika belum
+    // pernah ada sama sekali. Dipakai reader di thread pekerja.
+    shared_ptr<const CSRGraph> pinSnapshot() const {
+        shared_ptr<const CSRGraph> current = atomic_load(&published);
+        return current ? current : getSnapshot();
+    }
+    
+    // Dipanggil writer setelah satu batch perubahan agar reader yang memakai
+    // pinSnapshot() melihat versi terbaru
+    void publishSnapshot() const {
+        lock_guard<mutex> lock(writerMutex);
+        publishLocked();
+    }
 };
 
 #endif
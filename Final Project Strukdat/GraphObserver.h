@@ -0,0 +1,24 @@
+#ifndef GRAPH_OBSERVER_H
+#define GRAPH_OBSERVER_H
+
+#include "Route.h"
+#include <string>
+
+using namespace std;
+
+// Antarmuka untuk objek yang perlu tahu setiap perubahan graf secara
+// langsung (bukan hanya lewat nomor versi), misalnya struktur jalur
+// terpendek yang diperbaiki secara inkremental. Dipanggil setelah
+// perubahan diterapkan di GraphManager.
+class GraphObserver {
+public:
+    virtual ~GraphObserver() = default;
+
+    virtual void onLocationAdded(const string& /*name*/) {}
+    virtual void onLocationRemoved(const string& /*name*/) {}
+    virtual void onRouteAdded(const Route& /*route*/) {}
+    virtual void onRouteRemoved(const string& /*sourceName*/, const string& /*destName*/) {}
+    virtual void onRouteUpdated(const Route& /*route*/) {}
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+using namespace std;
+
+// Min-heap d-ary berindeks untuk ID node integer. Setiap node hanya
+// muncul sekali di heap sehingga decrease-key dilakukan di tempat,
+// tidak ada entri basi (stale) seperti pada priority_queue biasa.
+template <unsigned Arity = 4>
+class IndexedDaryHeap {
+public:
+    static constexpr uint32_t NOT_IN_HEAP = numeric_limits<uint32_t>::max();
+    static constexpr uint32_t POPPED = numeric_limits<uint32_t>::max() - 1;
+
+private:
+    struct Entry {
+        double key;
+        uint32_t id;
+    };
+
+    vector<Entry> heap;
+    vector<uint32_t> position;   // posisi node di heap, NOT_IN_HEAP, atau POPPED
+    vector<uint32_t> touched;    // node yang statusnya perlu direset
+
+    void place(size_t index, const Entry& entry) {
+        heap[index] = entry;
+        position[entry.id] = static_cast<uint32_t>(index);
+    }
+
+    void siftUp(size_t index) {
+        Entry entry = heap[index];
+        while (index > 0) {
+            size_t parent = (index - 1) / Arity;
+            if (heap[parent].key <= entry.key) break;
+            place(index, heap[parent]);
+            index = parent;
+        }
+        place(index, entry);
+    }
+
+    void siftDown(size_t index) {
+        Entry entry = heap[index];
+        size_t size = heap.size();
+        while (true) {
+            size_t first = index * Arity + 1;
+            if (first >= size) break;
+
+            size_t last = first + Arity < size ? first + Arity : size;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (heap[child].key < heap[best].key) best = child;
+            }
+            if (heap[best].key >= entry.key) break;
+
+            place(index, heap[best]);
+            index = best;
+        }
+        place(index, entry);
+    }
+
+public:
+    IndexedDaryHeap() = default;
+
+    // Menyiapkan heap untuk ID 0..nodeCount-1 dan mengosongkan isinya
+    void reset(size_t nodeCount) {
+        if (position.size() != nodeCount) {
+            position.assign(nodeCount, NOT_IN_HEAP);
+            touched.clear();
+        } else {
+            for (uint32_t id : touched) position[id] = NOT_IN_HEAP;
+            touched.clear();
+        }
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    bool contains(uint32_t id) const {
+        return position[id] < POPPED;
+    }
+
+    bool wasPopped(uint32_t id) const {
+        return position[id] == POPPED;
+    }
+
+    double topKey() const { return heap.front().key; }
+    uint32_t top() const { return heap.front().id; }
+
+    // Menambahkan node baru atau menurunkan key-nya jika sudah ada di heap.
+    // Node yang sudah di-pop tidak dimasukkan kembali.
+    bool pushOrDecrease(uint32_t id, double key) {
+        uint32_t pos = position[id];
+        if (pos == NOT_IN_HEAP) {
+            touched.push_back(id);
+            heap.push_back({key, id});
+            position[id] = static_cast<uint32_t>(heap.size() - 1);
+            siftUp(heap.size() - 1);
+            return true;
+        }
+        if (pos == POPPED) return false;
+        if (key < heap[pos].key) {
+            heap[pos].key = key;
+            siftUp(pos);
+        }
+        return true;
+    }
+
+    uint32_t pop() {
+        uint32_t id = heap.front().id;
+        position[id] = POPPED;
+
+        Entry last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            position[last.id] = 0;
+            siftDown(0);
+        }
+        return id;
+    }
+};
+
+#endif
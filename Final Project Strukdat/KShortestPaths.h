@@ -0,0 +1,285 @@
+#ifndef K_SHORTEST_PATHS_H
+#define K_SHORTEST_PATHS_H
+
+#include "CSRGraph.h"
+#include "SearchWorkspace.h"
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Algoritma Yen untuk k jalur terpendek tanpa loop. Alih-alih menjalankan
+// Dijkstra penuh untuk setiap spur, satu pohon jalur terpendek mundur ke
+// tujuan dibangun sekali dan dipakai ulang:
+//  - jika jalur pohon dari spur node tidak melewati node/edge yang diblokir,
+//    jalur itu langsung optimal tanpa pencarian sama sekali;
+//  - jika terblokir, A* dijalankan dengan jarak pohon sebagai heuristik
+//    (tetap konsisten karena memblokir hanya memperbesar jarak).
+class KShortestPaths {
+public:
+    struct Path {
+        vector<uint32_t> nodes;
+        vector<uint32_t> edges;
+        double cost;
+
+        Path() : cost(0) {}
+    };
+
+private:
+    // Kandidat disimpan ringkas: root = prefiks jalur diterima ke-parent,
+    // lalu detour eksplisit, lalu sisa jalur mengikuti pohon dari node join.
+    // Menyimpan jalur lengkap untuk setiap kandidat butuh memori O(k * L^2).
+    struct Candidate {
+        double cost;
+        uint32_t parent;
+        uint32_t deviation;
+        vector<uint32_t> detour;
+        uint32_t join;
+    };
+
+    struct QueueEntry {
+        double cost;
+        size_t index;
+
+        bool operator>(const QueueEntry& other) const {
+            if (cost != other.cost) return cost > other.cost;
+            return index > other.index;
+        }
+    };
+
+    vector<double> distanceToTarget;
+    vector<uint32_t> treeEdge;   // edge pertama jalur terpendek dari node ke tujuan
+    vector<uint32_t> spurEdge;   // edge masuk tiap node pada pencarian spur
+    vector<char> blocked;
+    SearchWorkspace reverseWorkspace;
+    SearchWorkspace spurWorkspace;
+
+    void buildReverseTree(const CSRGraph& csr, const double* weights, uint32_t endId) {
+        SearchWorkspace& ws = reverseWorkspace;
+        ws.reset(csr.getNodeCount());
+        ws.improve(endId, 0, CSRGraph::INVALID_NODE);
+        treeEdge.assign(csr.getNodeCount(), CSRGraph::INVALID_NODE);
+
+        while (!ws.heap.empty()) {
+            uint32_t u = ws.heap.pop();
+            for (uint32_t slot = csr.reverseBegin(u); slot < csr.reverseEnd(u); ++slot) {
+                uint32_t edge = csr.getReverseEdge(slot);
+                uint32_t source = csr.getReverseSource(slot);
+                if (ws.improve(source, ws.cost[u] + weights[edge], u)) {
+                    treeEdge[source] = edge;
+                }
+            }
+        }
+        distanceToTarget.assign(ws.cost.begin(), ws.cost.end());
+    }
+
+    static bool isRemoved(const vector<uint32_t>& removedEdges, uint32_t edge) {
+        return find(removedEdges.begin(), removedEdges.end(), edge) != removedEdges.end();
+    }
+
+    // Jalur pohon dari spur ke tujuan bisa dipakai langsung jika tidak
+    // menyentuh node/edge yang diblokir
+    bool treePathUsable(const CSRGraph& csr, uint32_t spur, uint32_t endId,
+                        const vector<uint32_t>& removedEdges) const {
+        if (spur != endId && isRemoved(removedEdges, treeEdge[spur])) return false;
+        for (uint32_t v = spur; v != endId; ) {
+            v = csr.getTarget(treeEdge[v]);
+            if (blocked[v]) return false;
+        }
+        return true;
+    }
+
+    // A* dari spur dengan jarak pohon sebagai heuristik. Hasilnya dipotong
+    // menjadi detour + node join, karena bagian akhirnya hampir selalu
+    // kembali ke pohon.
+    bool searchSpur(const CSRGraph& csr, const double* weights, uint32_t spur, uint32_t endId,
+                    const vector<uint32_t>& removedEdges, Candidate& candidate) {
+        SearchWorkspace& ws = spurWorkspace;
+        ws.reset(csr.getNodeCount());
+        ws.improve(spur, 0, CSRGraph::INVALID_NODE, distanceToTarget[spur]);
+
+        while (!ws.heap.empty()) {
+            uint32_t current = ws.heap.pop();
+            if (current == endId) break;
+
+            for (uint32_t e = csr.edgeBegin(current); e < csr.edgeEnd(current); ++e) {
+                uint32_t next = csr.getTarget(e);
+                if (blocked[next] || distanceToTarget[next] == numeric_limits<double>::infinity()) continue;
+                if (current == spur && isRemoved(removedEdges, e)) continue;
+
+                double newCost = ws.cost[current] + weights[e];
+                if (ws.improve(next, newCost, current, newCost + distanceToTarget[next])) {
+                    spurEdge[next] = e;
+                }
+            }
+        }
+        if (!ws.heap.wasPopped(endId)) return false;
+
+        vector<uint32_t> edges;
+        for (uint32_t v = endId; v != spur; v = ws.previous[v]) {
+            edges.push_back(spurEdge[v]);
+        }
+        reverse(edges.begin(), edges.end());
+
+        // Buang sufiks yang identik dengan jalur pohon
+        size_t detourLength = edges.size();
+        while (detourLength > 0) {
+            uint32_t edge = edges[detourLength - 1];
+            uint32_t from = detourLength == 1 ? spur : csr.getTarget(edges[detourLength - 2]);
+            if (treeEdge[from] != edge || (from == spur && isRemoved(removedEdges, edge))) break;
+            --detourLength;
+        }
+        candidate.detour.assign(edges.begin(), edges.begin() + detourLength);
+        candidate.join = detourLength == 0 ? spur : csr.getTarget(edges[detourLength - 1]);
+        candidate.cost += ws.cost[endId];
+        return true;
+    }
+
+    Path materialize(const CSRGraph& csr, const vector<Path>& accepted,
+                     const Candidate& candidate, uint32_t endId) const {
+        const Path& parent = accepted[candidate.parent];
+        Path path;
+        path.cost = candidate.cost;
+        path.nodes.assign(parent.nodes.begin(), parent.nodes.begin() + candidate.deviation + 1);
+        path.edges.assign(parent.edges.begin(), parent.edges.begin() + candidate.deviation);
+        for (uint32_t edge : candidate.detour) {
+            path.edges.push_back(edge);
+            path.nodes.push_back(csr.getTarget(edge));
+        }
+        for (uint32_t v = candidate.join; v != endId; ) {
+            uint32_t edge = treeEdge[v];
+            v = csr.getTarget(edge);
+            path.edges.push_back(edge);
+            path.nodes.push_back(v);
+        }
+        return path;
+    }
+
+    // Memanggil visit(edge) untuk setiap edge kandidat secara berurutan,
+    // tanpa membentuk jalurnya
+    template <typename Visit>
+    void forEachEdge(const CSRGraph& csr, const vector<Path>& accepted,
+                     const Candidate& candidate, uint32_t endId, Visit visit) const {
+        const Path& parent = accepted[candidate.parent];
+        for (uint32_t i = 0; i < candidate.deviation; ++i) visit(parent.edges[i]);
+        for (uint32_t edge : candidate.detour) visit(edge);
+        for (uint32_t v = candidate.join; v != endId; v = csr.getTarget(treeEdge[v])) {
+            visit(treeEdge[v]);
+        }
+    }
+
+    // Hash FNV-1a atas urutan edge; kunci utama pendeteksi duplikat
+    uint64_t pathHash(const CSRGraph& csr, const vector<Path>& accepted,
+                      const Candidate& candidate, uint32_t endId) const {
+        uint64_t hash = 1469598103934665603ULL;
+        forEachEdge(csr, accepted, candidate, endId, [&hash](uint32_t edge) {
+            hash = (hash ^ edge) * 1099511628211ULL;
+        });
+        return hash;
+    }
+
+    // Urutan edge lengkap kandidat; hanya dibentuk saat hash-nya sama
+    // dengan kandidat lain, agar dua jalur berbeda tidak dianggap sama
+    vector<uint32_t> edgeSequence(const CSRGraph& csr, const vector<Path>& accepted,
+                                  const Candidate& candidate, uint32_t endId) const {
+        vector<uint32_t> edges;
+        forEachEdge(csr, accepted, candidate, endId, [&edges](uint32_t edge) {
+            edges.push_back(edge);
+        });
+        return edges;
+    }
+
+public:
+    vector<Path> run(const CSRGraph& csr, const vector<double>& weightColumn,
+                     uint32_t startId, uint32_t endId, size_t k) {
+        vector<Path> accepted;
+        if (k == 0) return accepted;
+
+        const double* weights = weightColumn.data();
+        buildReverseTree(csr, weights, endId);
+        if (distanceToTarget[startId] == numeric_limits<double>::infinity()) return accepted;
+
+        blocked.assign(csr.getNodeCount(), 0);
+        spurEdge.resize(csr.getNodeCount());
+
+        Candidate shortest = { distanceToTarget[startId], 0, 0, vector<uint32_t>(), startId };
+        Path first;
+        first.nodes.push_back(startId);
+        accepted.push_back(first);  // parent sementara untuk materialize
+        accepted[0] = materialize(csr, accepted, shortest, endId);
+
+        vector<Candidate> candidates;
+        priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry>> queue;
+        // Hash jalur -> indeks kandidat (SHORTEST untuk jalur pertama). Hanya
+        // kandidat ringkas yang disimpan, bukan urutan edge-nya.
+        const size_t SHORTEST = numeric_limits<size_t>::max();
+        unordered_multimap<uint64_t, size_t> seen;
+        seen.emplace(pathHash(csr, accepted, shortest, endId), SHORTEST);
+        auto isDuplicate = [&](const Candidate& candidate, uint64_t hash) {
+            auto range = seen.equal_range(hash);
+            if (range.first == range.second) return false;
+            vector<uint32_t> edges = edgeSequence(csr, accepted, candidate, endId);
+            for (auto it = range.first; it != range.second; ++it) {
+                bool same = it->second == SHORTEST
+                    ? edges == accepted[0].edges
+                    : edges == edgeSequence(csr, accepted, candidates[it->second], endId);
+                if (same) return true;
+            }
+            return false;
+        };
+
+        vector<uint32_t> removedEdges;
+        while (accepted.size() < k) {
+            uint32_t parentIndex = static_cast<uint32_t>(accepted.size() - 1);
+            const Path& previous = accepted[parentIndex];
+
+            double rootCost = 0;
+            for (size_t i = 0; i + 1 < previous.nodes.size(); ++i) {
+                uint32_t spur = previous.nodes[i];
+
+                // Edge berikutnya dari semua jalur yang berbagi root yang sama
+                removedEdges.clear();
+                for (const Path& path : accepted) {
+                    if (path.edges.size() > i &&
+                        equal(previous.edges.begin(), previous.edges.begin() + i, path.edges.begin())) {
+                        removedEdges.push_back(path.edges[i]);
+                    }
+                }
+
+                Candidate candidate = { rootCost, parentIndex, static_cast<uint32_t>(i), vector<uint32_t>(), spur };
+                bool found = false;
+                if (treePathUsable(csr, spur, endId, removedEdges)) {
+                    candidate.cost += distanceToTarget[spur];
+                    found = true;
+                } else {
+                    found = searchSpur(csr, weights, spur, endId, removedEdges, candidate);
+                }
+
+                uint64_t hash = found ? pathHash(csr, accepted, candidate, endId) : 0;
+                if (found && !isDuplicate(candidate, hash)) {
+                    seen.emplace(hash, candidates.size());
+                    queue.push({ candidate.cost, candidates.size() });
+                    candidates.push_back(move(candidate));
+                }
+
+                blocked[spur] = 1;
+                rootCost += weights[previous.edges[i]];
+            }
+            for (uint32_t node : previous.nodes) {
+                blocked[node] = 0;
+            }
+
+            if (queue.empty()) break;
+            Path next = materialize(csr, accepted, candidates[queue.top().index], endId);
+            queue.pop();
+            accepted.push_back(move(next));
+        }
+        return accepted;
+    }
+};
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef KD_TREE_H
+#define KD_TREE_H
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <utility>
+
+using namespace std;
+
+// k-d tree statis dua dimensi untuk pencarian k tetangga terdekat.
+// Pohon disimpan implisit di dalam satu array: setiap rentang [first, last)
+// dibelah di median sumbu yang sebarannya lebih lebar, dan rentang kecil
+// dipindai linear. Jarak dibandingkan dalam bentuk kuadrat; jarak sama
+// diurutkan menurut id sehingga hasilnya deterministik.
+class KdTree {
+public:
+    struct Point {
+        double x;
+        double y;
+        uint32_t id;
+    };
+
+    typedef pair<double, uint32_t> Neighbor;  // (jarak kuadrat, id)
+
+private:
+    static constexpr size_t LEAF_SIZE = 8;
+
+    vector<Point> points;
+    vector<char> splitOnX;  // sumbu belahan untuk rentang yang median-nya di indeks ini
+
+    void build(size_t first, size_t last) {
+        if (last - first <= LEAF_SIZE) return;
+
+        double minX = numeric_limits<double>::infinity(), maxX = -minX;
+        double minY = minX, maxY = -minX;
+        for (size_t i = first; i < last; ++i) {
+            minX = min(minX, points[i].x);
+            maxX = max(maxX, points[i].x);
+            minY = min(minY, points[i].y);
+            maxY = max(maxY, points[i].y);
+        }
+        bool byX = maxX - minX >= maxY - minY;
+
+        size_t middle = first + (last - first) / 2;
+        nth_element(points.begin() + first, points.begin() + middle, points.begin() + last,
+            [byX](const Point& a, const Point& b) { return byX ? a.x < b.x : a.y < b.y; });
+        splitOnX[middle] = byX;
+
+        build(first, middle);
+        build(middle + 1, last);
+    }
+
+    // best terurut naik dan paling banyak k elemen; k biasanya kecil,
+    // jadi insertion sort lebih murah daripada heap
+    static void consider(const Point& point, double x, double y, size_t k, uint32_t excluded,
+                         vector<Neighbor>& best) {
+        if (point.id == excluded) return;
+        double dx = point.x - x;
+        double dy = point.y - y;
+        Neighbor candidate(dx * dx + dy * dy, point.id);
+        if (best.size() == k) {
+            if (!(candidate < best.back())) return;
+            best.pop_back();
+        }
+        best.insert(upper_bound(best.begin(), best.end(), candidate), candidate);
+    }
+
+    void search(size_t first, size_t last, double x, double y, size_t k, uint32_t excluded,
+                vector<Neighbor>& best) const {
+        if (last - first <= LEAF_SIZE) {
+            for (size_t i = first; i < last; ++i) consider(points[i], x, y, k, excluded, best);
+            return;
+        }
+
+        size_t middle = first + (last - first) / 2;
+        const Point& pivot = points[middle];
+        double diff = splitOnX[middle] ? x - pivot.x : y - pivot.y;
+
+        // Sisi yang memuat titik query lebih dulu; sisi lain hanya jika bidang
+        // belahannya tidak lebih jauh dari kandidat terjauh saat ini
+        bool lowerFirst = diff < 0;
+        if (lowerFirst) search(first, middle, x, y, k, excluded, best);
+        else search(middle + 1, last, x, y, k, excluded, best);
+
+        consider(pivot, x, y, k, excluded, best);
+        if (best.size() < k || diff * diff <= best.back().first) {
+            if (lowerFirst) search(middle + 1, last, x, y, k, excluded, best);
+            else search(first, middle, x, y, k, excluded, best);
+        }
+    }
+
+    template <typename Accept>
+    bool anyWithin(size_t first, size_t last, double x, double y, double radiusSquared,
+                   Accept& accept) const {
+        if (last - first <= LEAF_SIZE) {
+            for (size_t i = first; i < last; ++i) {
+                double dx = points[i].x - x;
+                double dy = points[i].y - y;
+                if (dx * dx + dy * dy < radiusSquared && accept(points[i])) return true;
+            }
+            return false;
+        }
+
+        size_t middle = first + (last - first) / 2;
+        const Point& pivot = points[middle];
+        double diff = splitOnX[middle] ? x - pivot.x : y - pivot.y;
+        bool lowerFirst = diff < 0;
+        if (lowerFirst ? anyWithin(first, middle, x, y, radiusSquared, accept)
+                       : anyWithin(middle + 1, last, x, y, radiusSquared, accept)) return true;
+
+        double dx = pivot.x - x;
+        double dy = pivot.y - y;
+        if (dx * dx + dy * dy < radiusSquared && accept(pivot)) return true;
+        if (diff * diff >= radiusSquared) return false;
+        return lowerFirst ? anyWithin(middle + 1, last, x, y, radiusSquared, accept)
+                          : anyWithin(first, middle, x, y, radiusSquared, accept);
+    }
+
+public:
+    explicit KdTree(const vector<Point>& input) : points(input), splitOnX(input.size(), 0) {
+        build(0, points.size());
+    }
+
+    size_t size() const { return points.size(); }
+
+    // Titik dalam urutan penyimpanan pohon; titik yang berdekatan di array
+    // juga berdekatan di ruang, jadi query berurutan lewat sini ramah cache
+    const vector<Point>& getPoints() const { return points; }
+
+    // k titik terdekat dari (x, y) selain id excluded, terurut dari yang
+    // terdekat. excluded boleh id yang tidak dipakai jika tidak ada yang dikecualikan.
+    void nearest(double x, double y, size_t k, uint32_t excluded, vector<Neighbor>& out) const {
+        out.clear();
+        if (k == 0 || points.empty()) return;
+        search(0, points.size(), x, y, k, excluded, out);
+    }
+
+    // true jika ada titik berjarak < radius dari (x, y) yang diterima
+    // accept(point); pencarian berhenti di titik pertama yang diterima
+    template <typename Accept>
+    bool anyWithin(double x, double y, double radius, Accept accept) const {
+        if (points.empty() || !(radius > 0)) return false;
+        return anyWithin(0, points.size(), x, y, radius * radius, accept);
+    }
+};
+
+#endif
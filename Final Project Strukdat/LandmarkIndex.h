@@ -0,0 +1,219 @@
+#ifndef LANDMARK_INDEX_H
+#define LANDMARK_INDEX_H
+
+#include "CSRGraph.h"
+#include "SearchWorkspace.h"
+#include "ThreadPool.h"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Indeks landmark untuk pencarian ALT (A*, Landmarks, Triangle inequality).
+// Untuk setiap landmark L disimpan jarak L -> v dan v -> L bagi semua node v,
+// sehingga d(v, t) >= max(d(v,L) - d(t,L), d(L,t) - d(L,v)).
+class LandmarkIndex {
+private:
+    static constexpr uint32_t FILE_MAGIC = 0x31544c41;  // "ALT1"
+
+    uint32_t nodeCount;
+    uint64_t fingerprint;
+    vector<uint32_t> landmarks;
+    // Tata letak per node: [v * k + i] agar satu evaluasi heuristik membaca memori berurutan
+    vector<double> fromLandmark;
+    vector<double> toLandmark;
+
+    static void fullDijkstra(const CSRGraph& csr, const vector<double>& weights,
+                             const vector<uint32_t>& sources, bool backward,
+                             SearchWorkspace& ws) {
+        ws.reset(csr.getNodeCount());
+        for (uint32_t source : sources) {
+            ws.improve(source, 0, CSRGraph::INVALID_NODE);
+        }
+
+        while (!ws.heap.empty()) {
+            uint32_t u = ws.heap.pop();
+            if (backward) {
+                for (uint32_t slot = csr.reverseBegin(u); slot < csr.reverseEnd(u); ++slot) {
+                    ws.improve(csr.getReverseSource(slot), ws.cost[u] + weights[csr.getReverseEdge(slot)], u);
+                }
+            } else {
+                for (uint32_t e = csr.edgeBegin(u); e < csr.edgeEnd(u); ++e) {
+                    ws.improve(csr.getTarget(e), ws.cost[u] + weights[e], u);
+                }
+            }
+        }
+    }
+
+    // Farthest-point: landmark berikutnya adalah node yang paling jauh
+    // (dan masih terjangkau) dari semua landmark yang sudah dipilih
+    void selectLandmarks(const CSRGraph& csr, const vector<double>& weights, size_t count) {
+        SearchWorkspace ws;
+        vector<uint32_t> seed(1, 0);
+        fullDijkstra(csr, weights, seed, false, ws);
+
+        while (landmarks.size() < count) {
+            const vector<uint32_t>& sources = landmarks.empty() ? seed : landmarks;
+            if (!landmarks.empty()) fullDijkstra(csr, weights, sources, false, ws);
+
+            uint32_t farthest = CSRGraph::INVALID_NODE;
+            double farthestCost = -1;
+            for (uint32_t v = 0; v < nodeCount; ++v) {
+                double cost = ws.cost[v];
+                if (cost == numeric_limits<double>::infinity()) {
+                    // Node yang belum terjangkau sama sekali diprioritaskan
+                    if (find(landmarks.begin(), landmarks.end(), v) == landmarks.end()) {
+                        cost = numeric_limits<double>::max();
+                    } else {
+                        continue;
+                    }
+                }
+                if (cost > farthestCost) {
+                    farthestCost = cost;
+                    farthest = v;
+                }
+            }
+            if (farthest == CSRGraph::INVALID_NODE || farthestCost <= 0) break;
+            landmarks.push_back(farthest);
+        }
+    }
+
+public:
+    LandmarkIndex() : nodeCount(0), fingerprint(0) {}
+
+    LandmarkIndex(const CSRGraph& csr, const vector<double>& weights, size_t landmarkCount,
+                  size_t threadCount = 0)
+        : nodeCount(csr.getNodeCount()), fingerprint(computeFingerprint(csr, weights)) {
+        if (nodeCount == 0) return;
+        selectLandmarks(csr, weights, min<size_t>(landmarkCount, nodeCount));
+
+        size_t k = landmarks.size();
+        fromLandmark.assign(static_cast<size_t>(nodeCount) * k, numeric_limits<double>::infinity());
+        toLandmark.assign(static_cast<size_t>(nodeCount) * k, numeric_limits<double>::infinity());
+
+        // Setiap landmark butuh satu Dijkstra maju dan satu mundur; semuanya
+        // independen sehingga dijalankan paralel, satu tugas per (landmark, arah)
+        ThreadPool pool(min(threadCount == 0 ? ThreadPool::defaultThreadCount() : threadCount, 2 * k));
+        for (size_t i = 0; i < k; ++i) {
+            for (int direction = 0; direction < 2; ++direction) {
+                pool.submit([this, &csr, &weights, i, k, direction]() {
+                    SearchWorkspace ws;
+                    vector<uint32_t> source(1, landmarks[i]);
+                    bool backward = direction == 1;
+                    fullDijkstra(csr, weights, source, backward, ws);
+
+                    vector<double>& table = backward ? toLandmark : fromLandmark;
+                    for (uint32_t id : ws.touched) {
+                        table[static_cast<size_t>(id) * k + i] = ws.cost[id];
+                    }
+                });
+            }
+        }
+        pool.wait();
+    }
+
+    // Sidik jari graf + kolom bobot, dipakai untuk memvalidasi file cache
+    static uint64_t computeFingerprint(const CSRGraph& csr, const vector<double>& weights) {
+        uint64_t hash = 1469598103934665603ULL;
+        auto mix = [&hash](const void* data, size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ULL;
+            }
+        };
+
+        uint32_t counts[2] = { csr.getNodeCount(), csr.getEdgeCount() };
+        mix(counts, sizeof(counts));
+        for (uint32_t v = 0; v < csr.getNodeCount(); ++v) {
+            const string& name = csr.getName(v);
+            mix(name.data(), name.size());
+            for (uint32_t e = csr.edgeBegin(v); e < csr.edgeEnd(v); ++e) {
+                uint32_t target = csr.getTarget(e);
+                mix(&target, sizeof(target));
+                mix(&weights[e], sizeof(double));
+            }
+        }
+        return hash;
+    }
+
+    uint64_t getFingerprint() const { return fingerprint; }
+    size_t getLandmarkCount() const { return landmarks.size(); }
+    const vector<uint32_t>& getLandmarks() const { return landmarks; }
+
+    // Batas bawah d(v, target) dari ketidaksamaan segitiga
+    double lowerBound(uint32_t v, uint32_t target) const {
+        size_t k = landmarks.size();
+        const double* fromV = &fromLandmark[static_cast<size_t>(v) * k];
+        const double* toV = &toLandmark[static_cast<size_t>(v) * k];
+        const double* fromT = &fromLandmark[static_cast<size_t>(target) * k];
+        const double* toT = &toLandmark[static_cast<size_t>(target) * k];
+        const double infinity = numeric_limits<double>::infinity();
+
+        double best = 0;
+        for (size_t i = 0; i < k; ++i) {
+            // d(v,t) >= d(v,L) - d(t,L); jika t bisa ke L tapi v tidak, v tak bisa ke t
+            if (toT[i] != infinity) {
+                if (toV[i] == infinity) return infinity;
+                best = max(best, toV[i] - toT[i]);
+            }
+            // d(v,t) >= d(L,t) - d(L,v); jika L bisa ke v tapi tidak ke t, v tak bisa ke t
+            if (fromV[i] != infinity) {
+                if (fromT[i] == infinity) return infinity;
+                best = max(best, fromT[i] - fromV[i]);
+            }
+        }
+        return best;
+    }
+
+    bool saveToFile(const string& filename) const {
+        ofstream file(filename, ios::binary);
+        if (!file.is_open()) return false;
+
+        uint32_t header[3] = { FILE_MAGIC, nodeCount, static_cast<uint32_t>(landmarks.size()) };
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(&fingerprint), sizeof(fingerprint));
+        file.write(reinterpret_cast<const char*>(landmarks.data()), landmarks.size() * sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(fromLandmark.data()), fromLandmark.size() * sizeof(double));
+        file.write(reinterpret_cast<const char*>(toLandmark.data()), toLandmark.size() * sizeof(double));
+        return file.good();
+    }
+
+    // Memuat tabel dari file; gagal jika file tidak cocok dengan graf saat ini
+    bool loadFromFile(const string& filename, uint64_t expectedFingerprint, uint32_t expectedNodeCount) {
+        ifstream file(filename, ios::binary);
+        if (!file.is_open()) return false;
+
+        uint32_t header[3];
+        uint64_t storedFingerprint;
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+        file.read(reinterpret_cast<char*>(&storedFingerprint), sizeof(storedFingerprint));
+        if (!file || header[0] != FILE_MAGIC || header[1] != expectedNodeCount ||
+            storedFingerprint != expectedFingerprint) {
+            return false;
+        }
+
+        size_t k = header[2];
+        size_t tableSize = static_cast<size_t>(expectedNodeCount) * k;
+        vector<uint32_t> storedLandmarks(k);
+        vector<double> storedFrom(tableSize), storedTo(tableSize);
+        file.read(reinterpret_cast<char*>(storedLandmarks.data()), k * sizeof(uint32_t));
+        file.read(reinterpret_cast<char*>(storedFrom.data()), tableSize * sizeof(double));
+        file.read(reinterpret_cast<char*>(storedTo.data()), tableSize * sizeof(double));
+        if (!file) return false;
+
+        nodeCount = expectedNodeCount;
+        fingerprint = storedFingerprint;
+        landmarks.swap(storedLandmarks);
+        fromLandmark.swap(storedFrom);
+        toLandmark.swap(storedTo);
+        return true;
+    }
+};
+
+#endif
@@ -5,6 +5,19 @@
 #include <cmath>
 using namespace std;
 
+// dx*dx + dy*dy dalam bentuk yang tetap. Jika target punya FMA (-mfma,
+// -march=native), bentuknya ditulis eksplisit sebagai fma(dx, dx, dy*dy)
+// sehingga hasilnya tidak bergantung pada apakah kompiler menggabungkan
+// perkalian dan penjumlahan (yang berubah menurut tingkat optimasi).
+// Kernel jarak di CoordinateStore.h memakai bentuk yang sama.
+inline double squaredLength(double dx, double dy) {
+#if defined(__FMA__)
+    return fma(dx, dx, dy * dy);
+#else
+    return dx * dx + dy * dy;
+#endif
+}
+
 class Location {
 private:
     string name;
@@ -27,7 +40,7 @@ public:
     double distanceTo(const Location& other) const {
         double dx = x - other.x;
         double dy = y - other.y;
-        return sqrt(dx*dx + dy*dy);
+        return sqrt(squaredLength(dx, dy));
     }
     
     bool operator<(const Location& other) const {
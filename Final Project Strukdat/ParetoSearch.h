@@ -0,0 +1,220 @@
+#ifndef PARETO_SEARCH_H
+#define PARETO_SEARCH_H
+
+#include "CSRGraph.h"
+#include "SearchWorkspace.h"
+#include "PreferenceManager.h"
+#include <vector>
+#include <string>
+#include <queue>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+// Satu rute pada Pareto front: tidak ada rute lain yang sekaligus lebih
+// cepat, lebih murah, dan lebih pendek
+struct ParetoRoute {
+    vector<string> path;
+    double time;
+    double cost;
+    double distance;
+
+    ParetoRoute() : time(0), cost(0), distance(0) {}
+
+    double score(const PreferenceManager& pref) const {
+        return pref.calculateScore(time, cost, distance);
+    }
+};
+
+struct ParetoFront {
+    vector<ParetoRoute> routes;  // terurut dari waktu tercepat
+    size_t labelsCreated;
+    size_t labelsSettled;
+    bool truncated;              // true jika batas jumlah label tercapai
+
+    ParetoFront() : labelsCreated(0), labelsSettled(0), truncated(false) {}
+
+    // Skor preferensi linear selalu minimum di salah satu titik front,
+    // jadi preferensi apa pun cukup dijawab dengan memindai front
+    const ParetoRoute* best(const PreferenceManager& pref) const {
+        const ParetoRoute* bestRoute = nullptr;
+        for (const ParetoRoute& route : routes) {
+            if (bestRoute == nullptr || route.score(pref) < bestRoute->score(pref)) {
+                bestRoute = &route;
+            }
+        }
+        return bestRoute;
+    }
+};
+
+// Pencarian label-setting multi-kriteria (waktu, biaya, jarak). Setiap
+// label disimpan di arena (satu vector, parent berupa indeks) sehingga tidak
+// ada alokasi per label. Label dibuang jika didominasi label permanen di
+// node yang sama, atau jika (label + batas bawah ke tujuan) didominasi rute
+// yang sudah sampai di tujuan. Batas bawah berasal dari Dijkstra mundur per
+// kriteria, dan juga dipakai sebagai potensial urutan antrian.
+//
+// Antrian diurutkan leksikografis dengan waktu sebagai kunci pertama, jadi
+// setiap label permanen pasti tidak lebih lambat dari label yang sedang
+// diuji. Uji dominasi cukup dilakukan pada (biaya, jarak) dengan "tangga"
+// 2D per node: terurut menurut biaya naik dengan jarak turun, O(log n).
+class ParetoSearch {
+private:
+    static constexpr uint32_t NO_LABEL = numeric_limits<uint32_t>::max();
+
+    class Staircase {
+    private:
+        vector<pair<double, double>> points;  // (biaya, jarak)
+
+    public:
+        bool empty() const { return points.empty(); }
+        void clear() { points.clear(); }
+
+        bool dominates(double cost, double distance) const {
+            auto it = upper_bound(points.begin(), points.end(), cost,
+                [](double value, const pair<double, double>& point) { return value < point.first; });
+            if (it == points.begin()) return false;
+            return (it - 1)->second <= distance;
+        }
+
+        // Hanya dipanggil untuk titik yang tidak didominasi
+        void insert(double cost, double distance) {
+            auto first = lower_bound(points.begin(), points.end(), cost,
+                [](const pair<double, double>& point, double value) { return point.first < value; });
+            auto last = first;
+            while (last != points.end() && last->second >= distance) ++last;
+            first = points.erase(first, last);
+            points.insert(first, make_pair(cost, distance));
+        }
+    };
+
+    struct Label {
+        double value[3];  // waktu, biaya, jarak
+        uint32_t node;
+        uint32_t parent;
+    };
+
+    struct QueueEntry {
+        double key[3];
+        uint32_t label;
+
+        bool operator>(const QueueEntry& other) const {
+            if (key[0] != other.key[0]) return key[0] > other.key[0];
+            if (key[1] != other.key[1]) return key[1] > other.key[1];
+            return key[2] > other.key[2];
+        }
+    };
+
+    vector<Label> arena;
+    vector<Staircase> settled;  // label permanen per node, diproyeksikan ke (biaya, jarak)
+    vector<uint32_t> touchedNodes;
+    vector<uint32_t> targetLabels;
+    vector<double> lowerBound[3];
+    SearchWorkspace boundWorkspace;
+
+    void computeLowerBounds(const CSRGraph& csr, uint32_t endId) {
+        static const CSRGraph::WeightColumn columns[3] = {
+            CSRGraph::WeightColumn::WAKTU, CSRGraph::WeightColumn::BIAYA, CSRGraph::WeightColumn::JARAK
+        };
+
+        SearchWorkspace& ws = boundWorkspace;
+        for (int k = 0; k < 3; ++k) {
+            const double* weights = csr.getWeights(columns[k]).data();
+            ws.reset(csr.getNodeCount());
+            ws.improve(endId, 0, CSRGraph::INVALID_NODE);
+            while (!ws.heap.empty()) {
+                uint32_t u = ws.heap.pop();
+                for (uint32_t slot = csr.reverseBegin(u); slot < csr.reverseEnd(u); ++slot) {
+                    ws.improve(csr.getReverseSource(slot), ws.cost[u] + weights[csr.getReverseEdge(slot)], u);
+                }
+            }
+            lowerBound[k].assign(ws.cost.begin(), ws.cost.end());
+        }
+    }
+
+public:
+    ParetoFront run(const CSRGraph& csr, uint32_t startId, uint32_t endId, size_t maxLabels) {
+        ParetoFront front;
+        uint32_t nodeCount = csr.getNodeCount();
+        if (settled.size() != nodeCount) settled.assign(nodeCount, Staircase());
+        for (uint32_t node : touchedNodes) {
+            settled[node].clear();
+        }
+        touchedNodes.clear();
+        targetLabels.clear();
+        arena.clear();
+
+        computeLowerBounds(csr, endId);
+        if (lowerBound[0][startId] == numeric_limits<double>::infinity()) return front;
+
+        const double* times = csr.getWeights(CSRGraph::WeightColumn::WAKTU).data();
+        const double* costs = csr.getWeights(CSRGraph::WeightColumn::BIAYA).data();
+        const double* distances = csr.getWeights(CSRGraph::WeightColumn::JARAK).data();
+
+        priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry>> queue;
+        arena.push_back({ { 0, 0, 0 }, startId, NO_LABEL });
+        queue.push({ { lowerBound[0][startId], lowerBound[1][startId], lowerBound[2][startId] }, 0 });
+
+        while (!queue.empty()) {
+            QueueEntry entry = queue.top();
+            queue.pop();
+
+            uint32_t id = entry.label;
+            uint32_t node = arena[id].node;
+            if (settled[endId].dominates(entry.key[1], entry.key[2]) ||
+                settled[node].dominates(arena[id].value[1], arena[id].value[2])) {
+                continue;
+            }
+
+            if (settled[node].empty()) touchedNodes.push_back(node);
+            settled[node].insert(arena[id].value[1], arena[id].value[2]);
+            ++front.labelsSettled;
+            if (node == endId) {
+                targetLabels.push_back(id);
+                continue;
+            }
+
+            for (uint32_t e = csr.edgeBegin(node); e < csr.edgeEnd(node); ++e) {
+                uint32_t next = csr.getTarget(e);
+                if (lowerBound[0][next] == numeric_limits<double>::infinity()) continue;
+
+                const double* value = arena[id].value;
+                Label label = { { value[0] + times[e], value[1] + costs[e], value[2] + distances[e] }, next, id };
+                QueueEntry candidate = { { label.value[0] + lowerBound[0][next],
+                                           label.value[1] + lowerBound[1][next],
+                                           label.value[2] + lowerBound[2][next] },
+                                         static_cast<uint32_t>(arena.size()) };
+                if (settled[endId].dominates(candidate.key[1], candidate.key[2]) ||
+                    settled[next].dominates(label.value[1], label.value[2])) {
+                    continue;
+                }
+
+                if (arena.size() >= maxLabels) {
+                    front.truncated = true;
+                    break;
+                }
+                arena.push_back(label);
+                queue.push(candidate);
+            }
+            if (front.truncated) break;
+        }
+
+        front.labelsCreated = arena.size();
+        for (uint32_t id : targetLabels) {
+            ParetoRoute route;
+            route.time = arena[id].value[0];
+            route.cost = arena[id].value[1];
+            route.distance = arena[id].value[2];
+            for (uint32_t at = id; at != NO_LABEL; at = arena[at].parent) {
+                route.path.push_back(csr.getName(arena[at].node));
+            }
+            reverse(route.path.begin(), route.path.end());
+            front.routes.push_back(route);
+        }
+        return front;
+    }
+};
+
+#endif
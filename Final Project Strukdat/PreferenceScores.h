@@ -0,0 +1,67 @@
+#ifndef PREFERENCE_SCORES_H
+#define PREFERENCE_SCORES_H
+
+#include "CSRGraph.h"
+#include "PreferenceManager.h"
+#include <vector>
+#include <cstddef>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+// Kolom skor preferensi W1*waktu + W2*biaya + W3*jarak untuk setiap edge
+// CSR, dihitung sekali per setelan preferensi sehingga pencarian cukup
+// membaca satu kolom seperti mode tunggal. Kernel memakai AVX (4 double)
+// jika dikompilasi dengan -mavx/-march=native, SSE2 (2 double) pada x86-64
+// biasa, dan loop skalar untuk sisanya atau di arsitektur lain.
+// Urutan operasi sama dengan PreferencePolicy: (W1*t + W2*c) + W3*d.
+inline void computePreferenceScoresScalar(const double* times, const double* costs, const double* distances,
+                                          size_t count, double weightWaktu, double weightBiaya,
+                                          double weightJarak, double* out) {
+    for (size_t e = 0; e < count; ++e) {
+        out[e] = weightWaktu * times[e] + weightBiaya * costs[e] + weightJarak * distances[e];
+    }
+}
+
+inline void computePreferenceScores(const double* times, const double* costs, const double* distances,
+                                    size_t count, double weightWaktu, double weightBiaya,
+                                    double weightJarak, double* out) {
+    size_t e = 0;
+#if defined(__AVX__)
+    __m256d w1 = _mm256_set1_pd(weightWaktu);
+    __m256d w2 = _mm256_set1_pd(weightBiaya);
+    __m256d w3 = _mm256_set1_pd(weightJarak);
+    for (; e + 4 <= count; e += 4) {
+        __m256d score = _mm256_add_pd(_mm256_mul_pd(w1, _mm256_loadu_pd(times + e)),
+                                      _mm256_mul_pd(w2, _mm256_loadu_pd(costs + e)));
+        score = _mm256_add_pd(score, _mm256_mul_pd(w3, _mm256_loadu_pd(distances + e)));
+        _mm256_storeu_pd(out + e, score);
+    }
+#elif defined(__SSE2__)
+    __m128d w1 = _mm_set1_pd(weightWaktu);
+    __m128d w2 = _mm_set1_pd(weightBiaya);
+    __m128d w3 = _mm_set1_pd(weightJarak);
+    for (; e + 2 <= count; e += 2) {
+        __m128d score = _mm_add_pd(_mm_mul_pd(w1, _mm_loadu_pd(times + e)),
+                                   _mm_mul_pd(w2, _mm_loadu_pd(costs + e)));
+        score = _mm_add_pd(score, _mm_mul_pd(w3, _mm_loadu_pd(distances + e)));
+        _mm_storeu_pd(out + e, score);
+    }
+#endif
+    computePreferenceScoresScalar(times + e, costs + e, distances + e, count - e,
+                                  weightWaktu, weightBiaya, weightJarak, out + e);
+}
+
+inline void computePreferenceScores(const CSRGraph& csr, const PreferenceManager& pref, vector<double>& out) {
+    out.resize(csr.getEdgeCount());
+    computePreferenceScores(csr.getWeights(CSRGraph::WeightColumn::WAKTU).data(),
+                            csr.getWeights(CSRGraph::WeightColumn::BIAYA).data(),
+                            csr.getWeights(CSRGraph::WeightColumn::JARAK).data(),
+                            out.size(), pref.getWeightWaktu(), pref.getWeightBiaya(),
+                            pref.getWeightJarak(), out.data());
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef QUERY_CACHE_H
+#define QUERY_CACHE_H
+
+#include <list>
+#include <unordered_map>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+struct CacheStats {
+    size_t hits;
+    size_t misses;
+    size_t invalidations;  // Berapa kali cache dikosongkan karena graf berubah
+    size_t size;
+    size_t capacity;
+
+    CacheStats() : hits(0), misses(0), invalidations(0), size(0), capacity(0) {}
+
+    double hitRate() const {
+        size_t total = hits + misses;
+        return total == 0 ? 0 : static_cast<double>(hits) / total;
+    }
+};
+
+// Cache LRU untuk hasil query yang terikat pada satu versi graf. Begitu
+// versi graf berubah, semua entri lama dibuang sekaligus.
+template <typename Value>
+class QueryCache {
+private:
+    typedef pair<string, Value> Entry;
+
+    list<Entry> entries;  // depan = paling baru dipakai
+    unordered_map<string, typename list<Entry>::iterator> index;
+    unsigned long long version;
+    CacheStats stats;
+
+    void syncVersion(unsigned long long graphVersion) {
+        if (graphVersion == version) return;
+        if (!entries.empty()) ++stats.invalidations;
+        entries.clear();
+        index.clear();
+        version = graphVersion;
+    }
+
+public:
+    explicit QueryCache(size_t capacity = 1024) : version(0) {
+        stats.capacity = capacity;
+    }
+
+    static string makeKey(const string& start, const string& end, const string& criterion) {
+        string key;
+        key.reserve(start.size() + end.size() + criterion.size() + 2);
+        key += start;
+        key += '\x1f';
+        key += end;
+        key += '\x1f';
+        key += criterion;
+        return key;
+    }
+
+    // Mengembalikan pointer ke nilai cache, atau nullptr jika tidak ada
+    const Value* find(const string& key, unsigned long long graphVersion) {
+        syncVersion(graphVersion);
+        auto it = index.find(key);
+        if (it == index.end()) {
+            ++stats.misses;
+            return nullptr;
+        }
+
+        ++stats.hits;
+        entries.splice(entries.begin(), entries, it->second);
+        return &it->second->second;
+    }
+
+    void insert(const string& key, const Value& value, unsigned long long graphVersion) {
+        syncVersion(graphVersion);
+        if (stats.capacity == 0) return;
+
+        auto it = index.find(key);
+        if (it != index.end()) {
+            it->second->second = value;
+            entries.splice(entries.begin(), entries, it->second);
+            return;
+        }
+
+        if (entries.size() >= stats.capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        entries.emplace_front(key, value);
+        index[key] = entries.begin();
+    }
+
+    void setCapacity(size_t capacity) {
+        stats.capacity = capacity;
+        while (entries.size() > capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+    void clear() {
+        entries.clear();
+        index.clear();
+    }
+
+    CacheStats getStats() const {
+        CacheStats current = stats;
+        current.size = entries.size();
+        return current;
+    }
+};
+
+#endif
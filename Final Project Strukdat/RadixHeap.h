@@ -0,0 +1,179 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include "CSRGraph.h"
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <cmath>
+#include <utility>
+
+using namespace std;
+
+// Radix heap monoton untuk key integer: key yang di-push tidak boleh lebih
+// kecil dari key terakhir yang di-pop (selalu benar pada Dijkstra dengan
+// bobot non-negatif). Entry ditempatkan di bucket menurut bit tertinggi yang
+// berbeda dari key terakhir, sehingga setiap entry paling banyak dipindah 64
+// kali dan tidak ada perbandingan antar-entry seperti pada heap biner.
+// Tidak ada decrease-key: entry basi dibuang oleh pemanggil saat di-pop.
+class RadixHeap {
+public:
+    typedef pair<uint64_t, uint32_t> Entry;  // (key, node)
+
+private:
+    vector<Entry> buckets[65];
+    uint64_t last;
+    size_t count;
+
+    static unsigned bucketIndex(uint64_t key, uint64_t reference) {
+        if (key == reference) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+        return 64 - __builtin_clzll(key ^ reference);
+#else
+        uint64_t diff = key ^ reference;
+        unsigned index = 0;
+        while (diff != 0) {
+            diff >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+public:
+    RadixHeap() : last(0), count(0) {}
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    void clear() {
+        for (vector<Entry>& bucket : buckets) bucket.clear();
+        last = 0;
+        count = 0;
+    }
+
+    void push(uint64_t key, uint32_t id) {
+        buckets[bucketIndex(key, last)].push_back(Entry(key, id));
+        ++count;
+    }
+
+    Entry pop() {
+        if (buckets[0].empty()) {
+            unsigned index = 1;
+            while (buckets[index].empty()) ++index;
+
+            // Key terkecil di bucket ini menjadi acuan baru; semua entry-nya
+            // pindah ke bucket yang lebih rendah
+            uint64_t smallest = numeric_limits<uint64_t>::max();
+            for (const Entry& entry : buckets[index]) {
+                if (entry.first < smallest) smallest = entry.first;
+            }
+            last = smallest;
+            for (const Entry& entry : buckets[index]) {
+                buckets[bucketIndex(entry.first, last)].push_back(entry);
+            }
+            buckets[index].clear();
+        }
+
+        Entry entry = buckets[0].back();
+        buckets[0].pop_back();
+        --count;
+        return entry;
+    }
+};
+
+// Kolom bobot yang diubah ke integer: bobot * scale dibulatkan. Tepat jika
+// semua bobot sudah bilangan bulat (atau kelipatan 0.1 / 0.01 / 0.001);
+// jika tidak, kuantisasi hanya dipakai bila galat relatif per edge bisa
+// dijaga <= tolerance, yang juga membatasi galat relatif total rute.
+struct QuantizedWeights {
+    bool usable;
+    bool exact;
+    double scale;
+    vector<uint64_t> values;
+    unsigned long long version;
+
+    QuantizedWeights() : usable(false), exact(false), scale(1), version(0) {}
+
+    static QuantizedWeights build(const vector<double>& weights, double tolerance, unsigned long long version) {
+        QuantizedWeights result;
+        result.version = version;
+
+        double minPositive = numeric_limits<double>::infinity();
+        double total = 0;
+        for (double weight : weights) {
+            if (!(weight >= 0) || weight == numeric_limits<double>::infinity()) return result;
+            if (weight > 0 && weight < minPositive) minPositive = weight;
+            total += weight;
+        }
+
+        static const double exactScales[] = { 1, 10, 100, 1000 };
+        for (double scale : exactScales) {
+            bool integral = true;
+            for (double weight : weights) {
+                double scaled = weight * scale;
+                if (fabs(scaled - round(scaled)) > 1e-9 * max(1.0, scaled)) {
+                    integral = false;
+                    break;
+                }
+            }
+            if (integral) {
+                result.scale = scale;
+                result.exact = true;
+                break;
+            }
+        }
+        if (!result.exact) {
+            if (tolerance <= 0 || minPositive == numeric_limits<double>::infinity()) return result;
+            // Galat pembulatan <= 0.5 per edge, relatif <= 0.5 / (scale * w)
+            result.scale = 0.5 / (tolerance * minPositive);
+        }
+
+        // Total seluruh bobot membatasi biaya rute mana pun; harus muat di
+        // uint64 dan tetap presisi sebagai double
+        if (total * result.scale >= 9007199254740992.0) return result;
+
+        result.values.resize(weights.size());
+        for (size_t e = 0; e < weights.size(); ++e) {
+            result.values[e] = static_cast<uint64_t>(llround(weights[e] * result.scale));
+        }
+        result.usable = true;
+        return result;
+    }
+};
+
+// Buffer kerja Dijkstra dengan radix heap, dipakai ulang antar query. Status
+// node disimpan berdampingan (satu akses memori per relaksasi); biaya asli
+// hanya disimpan terpisah jika bobot hasil kuantisasi tidak tepat.
+struct RadixWorkspace {
+    struct NodeState {
+        uint64_t key;
+        uint32_t previous;
+        uint32_t settled;
+    };
+
+    vector<NodeState> state;
+    vector<double> cost;
+    vector<uint32_t> touched;
+    RadixHeap heap;
+
+    void reset(size_t nodeCount) {
+        const NodeState unreached = { numeric_limits<uint64_t>::max(), CSRGraph::INVALID_NODE, 0 };
+        if (state.size() != nodeCount) {
+            state.assign(nodeCount, unreached);
+            cost.assign(nodeCount, numeric_limits<double>::infinity());
+        } else {
+            for (uint32_t id : touched) {
+                state[id] = unreached;
+                cost[id] = numeric_limits<double>::infinity();
+            }
+        }
+        touched.clear();
+        heap.clear();
+    }
+
+    bool isSettled(uint32_t id) const { return state[id].settled != 0; }
+    uint32_t previousOf(uint32_t id) const { return state[id].previous; }
+};
+
+#endif
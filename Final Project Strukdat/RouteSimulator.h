@@ -8,6 +8,8 @@
 #include <iomanip>
 #include <vector>
 #include <string>
+#include <set>
+#include <sstream>
 
 using namespace std;
 
@@ -65,6 +67,74 @@ public:
         displayDetailedJourney(result.path);
     }
     
+    // Tabel seluruh rute Pareto; rute terbaik untuk preferensi saat ini ditandai ⭐
+    void displayParetoFront(const ParetoFront& front, const PreferenceManager& pref) const {
+        if (front.routes.empty()) {
+            cout << "❌ Tidak ada rute untuk ditampilkan." << endl;
+            return;
+        }
+        
+        const ParetoRoute* best = front.best(pref);
+        cout << "\n🧭 " << front.routes.size() << " RUTE PARETO-OPTIMAL (tidak ada yang lebih unggul di semua kriteria)" << endl;
+        cout << "═══════════════════════════════════════════════════════════════════" << endl;
+        cout << left << setw(5) << "No" << setw(14) << "Waktu (mnt)" << setw(16) << "Biaya (Rp)"
+             << setw(13) << "Jarak (km)" << setw(8) << "Lokasi" << "Skor" << endl;
+        for (size_t i = 0; i < front.routes.size(); ++i) {
+            const ParetoRoute& route = front.routes[i];
+            cout << left << setw(5) << (i + 1) << fixed << setprecision(1)
+                 << setw(14) << route.time << setw(16) << (long long)route.cost
+                 << setw(13) << route.distance << setw(8) << route.path.size()
+                 << setprecision(2) << route.score(pref) << (&route == best ? " ⭐" : "") << endl;
+        }
+        cout << right;
+        cout << "═══════════════════════════════════════════════════════════════════" << endl;
+    }
+    
+    // Menampilkan rute-rute alternatif berdampingan: total, selisih dari
+    // rute terbaik, dan seberapa banyak segmen yang sama dengan rute terbaik
+    void displayAlternatives(const vector<PathResult>& routes, const string& mode) const {
+        if (routes.empty()) {
+            cout << "❌ Tidak ada rute untuk ditampilkan." << endl;
+            return;
+        }
+        
+        set<pair<string, string>> bestSegments;
+        for (size_t i = 0; i + 1 < routes[0].path.size(); ++i) {
+            bestSegments.insert(make_pair(routes[0].path[i], routes[0].path[i + 1]));
+        }
+        
+        cout << "\n🔀 " << routes.size() << " RUTE ALTERNATIF (mode " << mode << ")" << endl;
+        cout << "═══════════════════════════════════════════════════════════════════" << endl;
+        cout << left << setw(5) << "No" << setw(14) << "Total" << setw(14) << "Selisih"
+             << setw(9) << "Lokasi" << "Sama dgn #1" << endl;
+        for (size_t r = 0; r < routes.size(); ++r) {
+            const vector<string>& path = routes[r].path;
+            size_t shared = 0;
+            for (size_t i = 0; i + 1 < path.size(); ++i) {
+                if (bestSegments.count(make_pair(path[i], path[i + 1]))) ++shared;
+            }
+            double sharedPercent = path.size() > 1 ? 100.0 * shared / (path.size() - 1) : 100.0;
+            ostringstream difference;
+            difference << "+" << fixed << setprecision(1) << routes[r].totalCost - routes[0].totalCost;
+            
+            cout << left << setw(5) << (r + 1) << fixed << setprecision(1)
+                 << setw(14) << routes[r].totalCost
+                 << setw(14) << difference.str()
+                 << setw(9) << path.size() << setprecision(0) << sharedPercent << "%" << endl;
+        }
+        cout << right;
+        cout << "═══════════════════════════════════════════════════════════════════" << endl;
+        
+        for (size_t r = 0; r < routes.size(); ++r) {
+            cout << "#" << (r + 1) << ": ";
+            for (size_t i = 0; i < routes[r].path.size(); ++i) {
+                cout << routes[r].path[i];
+                if (i < routes[r].path.size() - 1) cout << " - ";
+            }
+            cout << endl;
+        }
+    }
+    
 private:
     void displayDetailedJourney(const vector<string>& path) const {
         cout << "\n📋 DETAIL PERJALANAN LANGKAH DEMI LANGKAH:" << endl;
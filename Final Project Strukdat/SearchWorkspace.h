@@ -0,0 +1,52 @@
+#ifndef SEARCH_WORKSPACE_H
+#define SEARCH_WORKSPACE_H
+
+#include "CSRGraph.h"
+#include "IndexedHeap.h"
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+using namespace std;
+
+// Buffer kerja pencarian yang dipakai ulang antar query. Hanya node yang
+// disentuh query sebelumnya yang direset, bukan seluruh array.
+struct SearchWorkspace {
+    vector<double> cost;
+    vector<uint32_t> previous;
+    vector<uint32_t> touched;
+    IndexedDaryHeap<4> heap;
+    
+    void reset(size_t nodeCount) {
+        if (cost.size() != nodeCount) {
+            cost.assign(nodeCount, numeric_limits<double>::infinity());
+            previous.assign(nodeCount, CSRGraph::INVALID_NODE);
+        } else {
+            for (uint32_t id : touched) {
+                cost[id] = numeric_limits<double>::infinity();
+                previous[id] = CSRGraph::INVALID_NODE;
+            }
+        }
+        touched.clear();
+        heap.reset(nodeCount);
+    }
+    
+    bool isSettled(uint32_t id) const { return heap.wasPopped(id); }
+    uint32_t previousOf(uint32_t id) const { return previous[id]; }
+    
+    bool improve(uint32_t id, double newCost, uint32_t from) {
+        return improve(id, newCost, from, newCost);
+    }
+    
+    // Versi dengan key heap terpisah dari biaya (dipakai A*: key = g + h)
+    bool improve(uint32_t id, double newCost, uint32_t from, double key) {
+        if (!(newCost < cost[id]) || heap.wasPopped(id)) return false;
+        if (cost[id] == numeric_limits<double>::infinity()) touched.push_back(id);
+        cost[id] = newCost;
+        previous[id] = from;
+        heap.pushOrDecrease(id, key);
+        return true;
+    }
+};
+
+#endif
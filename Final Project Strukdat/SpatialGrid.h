@@ -0,0 +1,96 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+
+using namespace std;
+
+// Spatial hash seragam untuk pencarian radius. Setiap titik masuk ke sel
+// persegi berukuran cellSize; jika cellSize >= radius, semua titik dalam
+// radius dari (x, y) pasti berada di sel (x, y) atau delapan sel di
+// sekitarnya. Hanya sel yang berisi titik yang disimpan (tabel hash), dan
+// ID titik disusun berurutan per sel sehingga satu sel = satu rentang array.
+class SpatialGrid {
+private:
+    double cellSize;
+    vector<uint32_t> order;  // ID titik, dikelompokkan per sel
+    unordered_map<uint64_t, pair<uint32_t, uint32_t>> cells;  // kunci sel -> rentang di order
+
+    int64_t cellOf(double coordinate) const {
+        return static_cast<int64_t>(floor(coordinate / cellSize));
+    }
+
+    // Sel yang jauh bisa berbagi kunci jika koordinat selnya melebihi 32 bit;
+    // pemanggil tetap memeriksa jarak, jadi hasilnya hanya sedikit lebih lambat
+    static uint64_t keyOf(int64_t cellX, int64_t cellY) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+    }
+
+public:
+    SpatialGrid(const vector<double>& xs, const vector<double>& ys, double cellSize)
+        : cellSize(cellSize > 0 ? cellSize : 1.0) {
+        vector<pair<uint64_t, uint32_t>> keyed(xs.size());
+        for (uint32_t id = 0; id < xs.size(); ++id) {
+            keyed[id] = make_pair(keyOf(cellOf(xs[id]), cellOf(ys[id])), id);
+        }
+        sort(keyed.begin(), keyed.end());
+
+        order.resize(keyed.size());
+        for (uint32_t i = 0; i < keyed.size(); ++i) {
+            order[i] = keyed[i].second;
+            if (i == 0 || keyed[i].first != keyed[i - 1].first) {
+                cells[keyed[i].first] = make_pair(i, i + 1);
+            } else {
+                cells[keyed[i].first].second = i + 1;
+            }
+        }
+    }
+
+    double getCellSize() const { return cellSize; }
+    size_t getCellCount() const { return cells.size(); }
+
+    // ID titik dikelompokkan per sel; memproses titik dalam urutan ini
+    // membuat sel-sel tetangga yang dibaca tetap hangat di cache
+    const vector<uint32_t>& getOrder() const { return order; }
+
+    // Memanggil fn(first, last) untuk rentang posisi di getOrder() yang
+    // mencakup sel (x, y) dan delapan sel sekitarnya. Sel yang bersebelahan
+    // di urutan kunci (biasanya tiga sel satu kolom) digabung menjadi satu
+    // rentang, sehingga pemanggil bisa memproses titiknya per blok.
+    template <typename Fn>
+    void forEachRangeNear(double x, double y, Fn fn) const {
+        int64_t cellX = cellOf(x);
+        int64_t cellY = cellOf(y);
+        for (int64_t dx = -1; dx <= 1; ++dx) {
+            uint32_t first = 0, last = 0;
+            for (int64_t dy = -1; dy <= 1; ++dy) {
+                auto it = cells.find(keyOf(cellX + dx, cellY + dy));
+                if (it == cells.end()) continue;
+                if (first != last && it->second.first == last) {
+                    last = it->second.second;
+                    continue;
+                }
+                if (first != last) fn(first, last);
+                first = it->second.first;
+                last = it->second.second;
+            }
+            if (first != last) fn(first, last);
+        }
+    }
+
+    // Memanggil fn(id) untuk setiap titik di sel (x, y) dan delapan sel
+    // sekitarnya, termasuk titik di (x, y) itu sendiri
+    template <typename Fn>
+    void forEachNear(double x, double y, Fn fn) const {
+        forEachRangeNear(x, y, [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) fn(order[i]);
+        });
+    }
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+using namespace std;
+
+// Thread pool sederhana dengan antrian tugas bersama. wait() menunggu
+// sampai semua tugas yang sudah di-submit selesai dikerjakan.
+class ThreadPool {
+private:
+    vector<thread> workers;
+    queue<function<void()>> tasks;
+    mutex queueMutex;
+    condition_variable taskAvailable;
+    condition_variable allDone;
+    size_t activeTasks;
+    bool stopping;
+
+    void workerLoop() {
+        while (true) {
+            function<void()> task;
+            {
+                unique_lock<mutex> lock(queueMutex);
+                taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) return;
+
+                task = move(tasks.front());
+                tasks.pop();
+            }
+
+            task();
+
+            {
+                lock_guard<mutex> lock(queueMutex);
+                --activeTasks;
+                if (activeTasks == 0) allDone.notify_all();
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t threadCount = 0) : activeTasks(0), stopping(false) {
+        if (threadCount == 0) threadCount = defaultThreadCount();
+        for (size_t i = 0; i < threadCount; ++i) {
+            workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    virtual ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            stopping = true;
+        }
+        taskAvailable.notify_all();
+        for (thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    static size_t defaultThreadCount() {
+        unsigned hardware = thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+    size_t size() const { return workers.size(); }
+
+    void submit(function<void()> task) {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            tasks.push(move(task));
+            ++activeTasks;
+        }
+        taskAvailable.notify_one();
+    }
+
+    void wait() {
+        unique_lock<mutex> lock(queueMutex);
+        allDone.wait(lock, [this] { return activeTasks == 0; });
+    }
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef WEIGHT_POLICY_H
+#define WEIGHT_POLICY_H
+
+#include "CSRGraph.h"
+#include "PreferenceManager.h"
+#include <cstdint>
+
+using namespace std;
+
+// Policy bobot edge untuk mesin pencarian. Mode ("jarak"/"waktu"/"biaya")
+// diubah menjadi tipe sekali saja di batas API, sehingga di dalam loop
+// relaksasi pemilihan bobot hanyalah satu load yang di-inline compiler,
+// bukan perbandingan string per edge seperti Route::getWeightByMode.
+template <CSRGraph::WeightColumn Column>
+struct ColumnPolicy {
+    const double* weights;
+
+    explicit ColumnPolicy(const CSRGraph& csr) : weights(csr.getWeights(Column).data()) {}
+
+    double operator()(uint32_t edge) const { return weights[edge]; }
+};
+
+typedef ColumnPolicy<CSRGraph::WeightColumn::JARAK> DistancePolicy;
+typedef ColumnPolicy<CSRGraph::WeightColumn::WAKTU> TimePolicy;
+typedef ColumnPolicy<CSRGraph::WeightColumn::BIAYA> CostPolicy;
+
+// Skor gabungan preferensi dihitung langsung dari tiga kolom CSR
+struct PreferencePolicy {
+    const double* times;
+    const double* costs;
+    const double* distances;
+    double weightWaktu;
+    double weightBiaya;
+    double weightJarak;
+
+    PreferencePolicy(const CSRGraph& csr, const PreferenceManager& pref)
+        : times(csr.getWeights(CSRGraph::WeightColumn::WAKTU).data()),
+          costs(csr.getWeights(CSRGraph::WeightColumn::BIAYA).data()),
+          distances(csr.getWeights(CSRGraph::WeightColumn::JARAK).data()),
+          weightWaktu(pref.getWeightWaktu()),
+          weightBiaya(pref.getWeightBiaya()),
+          weightJarak(pref.getWeightJarak()) {}
+
+    double operator()(uint32_t edge) const {
+        return weightWaktu * times[edge] + weightBiaya * costs[edge] + weightJarak * distances[edge];
+    }
+};
+
+// Kolom skor yang sudah dihitung di luar pencarian (lihat PreferenceScores.h):
+// satu load per edge seperti mode tunggal
+struct ScoreColumnPolicy {
+    const double* scores;
+
+    explicit ScoreColumnPolicy(const vector<double>& scores) : scores(scores.data()) {}
+
+    double operator()(uint32_t edge) const { return scores[edge]; }
+};
+
+// Memanggil fn dengan policy yang sesuai kolom; setiap cabang menghasilkan
+// instansiasi template tersendiri dari mesin pencarian yang dipanggil fn
+template <typename Fn>
+auto withColumnPolicy(const CSRGraph& csr, CSRGraph::WeightColumn column, Fn&& fn)
+    -> decltype(fn(DistancePolicy(csr))) {
+    switch (column) {
+        case CSRGraph::WeightColumn::WAKTU: return fn(TimePolicy(csr));
+        case CSRGraph::WeightColumn::BIAYA: return fn(CostPolicy(csr));
+        case CSRGraph::WeightColumn::JARAK:
+        default: return fn(DistancePolicy(csr));
+    }
+}
+
+#endif
@@ -0,0 +1,1264 @@
+#include "GraphManager.h"
+#include "DijkstraAlgorithm.h"
+#include "DynamicShortestPathTree.h"
+#include "PreferenceManager.h"
+#include "AutoRouteGenerator.h"
+#include "CoordinateStore.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <atomic>
+
+using namespace std;
+
+// Program benchmark terpisah untuk mengukur performa mesin pencarian rute.
+// Kompilasi: g++ -O2 -std=c++17 -pthread benchmark.cpp -o benchmark
+//            (tambahkan -march=native agar kernel skor memakai AVX)
+// Jalankan : ./benchmark [jumlah_lokasi] [bagian]
+//            bagian (opsional): heap, early, bidi, astar, ch, cch, alt, matrix, cache, policy,
+//            scores, pareto, ksp, budget, delta, concurrent, radix, generate, dynamic
+
+// Implementasi Dijkstra versi awal (map/set/priority_queue<string>) yang
+// disimpan hanya sebagai pembanding.
+class LegacyDijkstra {
+private:
+    const GraphManager& graph;
+
+public:
+    explicit LegacyDijkstra(const GraphManager& graph) : graph(graph) {}
+
+    double findShortestPath(const string& start, const string& end, const string& mode) const {
+        map<string, double> cost;
+        map<string, string> previous;
+        set<string> visited;
+
+        auto cmp = [&cost](const string& a, const string& b) {
+            return cost[a] > cost[b];
+        };
+        priority_queue<string, vector<string>, decltype(cmp)> pq(cmp);
+
+        for (const auto& pair : graph.getLocations()) {
+            cost[pair.first] = numeric_limits<double>::infinity();
+        }
+
+        cost[start] = 0;
+        pq.push(start);
+
+        while (!pq.empty()) {
+            string current = pq.top();
+            pq.pop();
+
+            if (visited.count(current)) continue;
+            visited.insert(current);
+
+            for (const auto& route : graph.getRoutesFrom(current)) {
+                string neighbor = route.getDestination();
+                double weight = route.getWeightByMode(mode);
+
+                double newCost = cost[current] + weight;
+                if (newCost < cost[neighbor]) {
+                    cost[neighbor] = newCost;
+                    previous[neighbor] = current;
+                    pq.push(neighbor);
+                }
+            }
+        }
+
+        return cost[end];
+    }
+};
+
+class Stopwatch {
+private:
+    chrono::steady_clock::time_point begin;
+
+public:
+    Stopwatch() : begin(chrono::steady_clock::now()) {}
+
+    double elapsedMs() const {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+    }
+};
+
+// Membuat jaringan grid dengan koordinat acak kecil (jitter) dan rute dua arah
+// ke tetangga kanan dan bawah. Biaya dibulatkan ke rupiah penuh.
+void buildGridNetwork(GraphManager& graph, size_t locationCount, unsigned seed) {
+    size_t side = static_cast<size_t>(ceil(sqrt(static_cast<double>(locationCount))));
+    mt19937 rng(seed);
+    uniform_real_distribution<double> jitter(-3.0, 3.0);
+
+    streambuf* original = cout.rdbuf();
+    ostringstream sink;
+    cout.rdbuf(sink.rdbuf());
+
+    for (size_t i = 0; i < locationCount; ++i) {
+        double x = (i % side) * 10.0 + jitter(rng);
+        double y = (i / side) * 10.0 + jitter(rng);
+        graph.addLocation("K" + to_string(i), x, y);
+    }
+
+    uniform_real_distribution<double> speed(2.0, 5.0);
+    for (size_t i = 0; i < locationCount; ++i) {
+        size_t neighbors[2] = { i + 1, i + side };
+        bool valid[2] = { (i + 1) % side != 0 && i + 1 < locationCount, i + side < locationCount };
+
+        for (int k = 0; k < 2; ++k) {
+            if (!valid[k]) continue;
+            const string a = "K" + to_string(i);
+            const string b = "K" + to_string(neighbors[k]);
+            double distance = graph.getLocations().at(a).distanceTo(graph.getLocations().at(b));
+            double time = round(distance * speed(rng));
+            double cost = round(distance * 7500);
+            graph.addBidirectionalRoute(a, b, time, cost);
+        }
+    }
+
+    cout.rdbuf(original);
+}
+
+vector<pair<string, string>> makeQueries(size_t locationCount, size_t queryCount, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_int_distribution<size_t> pick(0, locationCount - 1);
+    vector<pair<string, string>> queries;
+    for (size_t i = 0; i < queryCount; ++i) {
+        queries.push_back({ "K" + to_string(pick(rng)), "K" + to_string(pick(rng)) });
+    }
+    return queries;
+}
+
+void benchmarkHeapDijkstra(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Dijkstra: versi awal vs heap 4-ary berindeks ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();  // biaya freeze tidak dihitung per query
+    dijkstra.setRadixHeapEnabled(false);
+
+    LegacyDijkstra legacy(graph);
+    size_t legacyQueries = min<size_t>(3, queries.size());
+
+    Stopwatch legacyWatch;
+    vector<double> legacyCosts;
+    for (size_t i = 0; i < legacyQueries; ++i) {
+        legacyCosts.push_back(legacy.findShortestPath(queries[i].first, queries[i].second, "waktu"));
+    }
+    double legacyMs = legacyWatch.elapsedMs() / legacyQueries;
+
+    Stopwatch heapWatch;
+    vector<double> heapCosts;
+    for (const auto& query : queries) {
+        heapCosts.push_back(dijkstra.findShortestPath(query.first, query.second, "waktu").totalCost);
+    }
+    double heapMs = heapWatch.elapsedMs() / queries.size();
+
+    bool match = true;
+    for (size_t i = 0; i < legacyQueries; ++i) {
+        if (fabs(legacyCosts[i] - heapCosts[i]) > 1e-6) match = false;
+    }
+
+    cout << fixed << setprecision(3);
+    cout << "Versi awal      : " << legacyMs << " ms/query (" << legacyQueries << " query)" << endl;
+    cout << "Heap berindeks  : " << heapMs << " ms/query (" << queries.size() << " query)" << endl;
+    cout << "Speedup         : " << setprecision(1) << legacyMs / heapMs << "x" << endl;
+    cout << "Hasil sama      : " << (match ? "ya" : "TIDAK") << endl;
+}
+
+void benchmarkEarlyTermination(const GraphManager& graph, size_t locationCount) {
+    cout << "\n=== Early termination: query antar kota berdekatan ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+
+    size_t side = static_cast<size_t>(ceil(sqrt(static_cast<double>(locationCount))));
+    mt19937 rng(5);
+    uniform_int_distribution<size_t> pick(0, locationCount - 1);
+
+    size_t queryCount = 200;
+    size_t totalSettled = 0;
+    size_t found = 0;
+    Stopwatch watch;
+    for (size_t i = 0; i < queryCount; ++i) {
+        size_t source = pick(rng);
+        size_t target = min(locationCount - 1, source + 5 + 5 * side);
+        PathResult result = dijkstra.findShortestPath("K" + to_string(source), "K" + to_string(target), "waktu");
+        totalSettled += result.settledNodes;
+        if (!result.path.empty()) ++found;
+    }
+    double ms = watch.elapsedMs() / queryCount;
+
+    cout << fixed << setprecision(3);
+    cout << "Waktu rata-rata : " << ms << " ms/query (" << found << "/" << queryCount << " ditemukan)" << endl;
+    cout << "Node diselesaikan rata-rata: " << totalSettled / queryCount
+         << " dari " << locationCount << " lokasi" << endl;
+}
+
+void benchmarkBidirectional(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Dijkstra satu arah vs dua arah (query jarak jauh) ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+
+    size_t forwardSettled = 0, bidirectionalSettled = 0;
+    bool match = true;
+
+    Stopwatch forwardWatch;
+    vector<double> forwardCosts;
+    for (const auto& query : queries) {
+        PathResult result = dijkstra.findShortestPath(query.first, query.second, "waktu");
+        forwardCosts.push_back(result.totalCost);
+        forwardSettled += result.settledNodes;
+    }
+    double forwardMs = forwardWatch.elapsedMs() / queries.size();
+
+    Stopwatch bidirectionalWatch;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        PathResult result = dijkstra.findShortestPathBidirectional(queries[i].first, queries[i].second, "waktu");
+        bidirectionalSettled += result.settledNodes;
+        if (fabs(result.totalCost - forwardCosts[i]) > 1e-6) match = false;
+    }
+    double bidirectionalMs = bidirectionalWatch.elapsedMs() / queries.size();
+
+    cout << fixed << setprecision(3);
+    cout << "Satu arah : " << forwardMs << " ms/query, " << forwardSettled / queries.size() << " node" << endl;
+    cout << "Dua arah  : " << bidirectionalMs << " ms/query, " << bidirectionalSettled / queries.size() << " node" << endl;
+    cout << "Hasil sama: " << (match ? "ya" : "TIDAK") << endl;
+}
+
+void benchmarkAStar(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== A* (heuristik koordinat) vs Dijkstra ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+
+    for (const string mode : { "jarak", "waktu", "biaya" }) {
+        size_t dijkstraSettled = 0, astarSettled = 0;
+        bool match = true;
+
+        Stopwatch dijkstraWatch;
+        vector<double> costs;
+        for (const auto& query : queries) {
+            PathResult result = dijkstra.findShortestPath(query.first, query.second, mode);
+            costs.push_back(result.totalCost);
+            dijkstraSettled += result.settledNodes;
+        }
+        double dijkstraMs = dijkstraWatch.elapsedMs() / queries.size();
+
+        Stopwatch astarWatch;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            PathResult result = dijkstra.findShortestPathAStar(queries[i].first, queries[i].second, mode);
+            astarSettled += result.settledNodes;
+            if (fabs(result.totalCost - costs[i]) > 1e-6 * max(1.0, costs[i])) match = false;
+        }
+        double astarMs = astarWatch.elapsedMs() / queries.size();
+
+        cout << fixed << setprecision(3);
+        cout << "[" << mode << "] Dijkstra " << dijkstraMs << " ms, " << dijkstraSettled / queries.size()
+             << " node | A* " << astarMs << " ms, " << astarSettled / queries.size() << " node"
+             << " | " << (dijkstraSettled - astarSettled) / queries.size() << " node lebih sedikit"
+             << " | hasil sama: " << (match ? "ya" : "TIDAK") << endl;
+    }
+}
+
+void benchmarkContractionHierarchies(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Contraction Hierarchies ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+
+    Stopwatch preprocessWatch;
+    const ContractionHierarchy& hierarchy = dijkstra.getHierarchy(CSRGraph::WeightColumn::WAKTU);
+    cout << fixed << setprecision(0);
+    cout << "Preprocessing (waktu): " << preprocessWatch.elapsedMs() << " ms, "
+         << hierarchy.getShortcutCount() << " shortcut" << endl;
+
+    vector<double> costs;
+    for (const auto& query : queries) {
+        costs.push_back(dijkstra.findShortestPath(query.first, query.second, "waktu").totalCost);
+    }
+
+    bool match = true;
+    size_t settled = 0;
+    size_t rounds = 50;
+    Stopwatch queryWatch;
+    for (size_t round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < queries.size(); ++i) {
+            PathResult result = dijkstra.findShortestPathCH(queries[i].first, queries[i].second, "waktu");
+            settled += result.settledNodes;
+            if (fabs(result.totalCost - costs[i]) > 1e-6 * max(1.0, costs[i])) match = false;
+        }
+    }
+    double queryUs = queryWatch.elapsedMs() * 1000.0 / (rounds * queries.size());
+
+    cout << setprecision(1);
+    cout << "Query CH  : " << queryUs << " us/query (termasuk unpack path), "
+         << settled / (rounds * queries.size()) << " node" << endl;
+    cout << "Hasil sama: " << (match ? "ya" : "TIDAK") << endl;
+}
+
+void benchmarkCustomizableHierarchy(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Customizable CH (preferensi) ===" << endl;
+
+    DijkstraAlgorithm plain(graph);
+    DijkstraAlgorithm dijkstra(graph);
+    plain.getSnapshot();
+    dijkstra.getSnapshot();
+
+    Stopwatch preprocessWatch;
+    dijkstra.prepareCustomizableHierarchy();
+    cout << fixed << setprecision(0);
+    cout << "Preprocessing topologi: " << preprocessWatch.elapsedMs() << " ms, "
+         << dijkstra.getCustomizableHierarchy().getArcCount() << " arc" << endl;
+
+    const int settings[3][3] = { { 1, 2, 3 }, { 2, 1, 3 }, { 3, 2, 1 } };
+    for (const auto& setting : settings) {
+        PreferenceManager pref;
+        pref.setPriorities(setting[0], setting[1], setting[2]);
+
+        Stopwatch customizeWatch;
+        dijkstra.getCustomizedMetric(pref);
+        double customizeMs = customizeWatch.elapsedMs();
+
+        vector<double> costs;
+        Stopwatch dijkstraWatch;
+        for (const auto& query : queries) {
+            costs.push_back(plain.findBestRouteWithPreference(query.first, query.second, pref).totalCost);
+        }
+        double dijkstraMs = dijkstraWatch.elapsedMs() / queries.size();
+
+        // Cache hasil dilewati lewat batas jumlah node agar setiap ronde benar-benar query CCH
+        bool match = true;
+        size_t settled = 0;
+        size_t rounds = 50;
+        const CustomizableHierarchy& hierarchy = dijkstra.getCustomizableHierarchy();
+        const CustomizableHierarchy::Metric& metric = dijkstra.getCustomizedMetric(pref);
+        const CSRGraph& csr = dijkstra.getSnapshot();
+        CustomizableHierarchy::Workspace ws;
+        vector<uint32_t> ids;
+        Stopwatch queryWatch;
+        for (size_t round = 0; round < rounds; ++round) {
+            for (size_t i = 0; i < queries.size(); ++i) {
+                size_t querySettled = 0;
+                double cost = hierarchy.query(metric, csr.getId(queries[i].first), csr.getId(queries[i].second),
+                                              ws, ids, querySettled);
+                settled += querySettled;
+                if (fabs(cost - costs[i]) > 1e-6 * max(1.0, costs[i])) match = false;
+            }
+        }
+        double queryUs = queryWatch.elapsedMs() * 1000.0 / (rounds * queries.size());
+
+        cout << "[" << setting[0] << "-" << setting[1] << "-" << setting[2] << "] customization "
+             << setprecision(1) << customizeMs << " ms | Dijkstra " << setprecision(3) << dijkstraMs
+             << " ms | CCH " << setprecision(1) << queryUs << " us/query, "
+             << settled / (rounds * queries.size()) << " node | hasil sama: " << (match ? "ya" : "TIDAK") << endl;
+    }
+}
+
+void benchmarkLandmarks(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== ALT (landmark) ===" << endl;
+
+    // Hapus cache lama agar waktu preprocessing benar-benar terukur
+    remove("./landmarks_waktu.alt");
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+
+    Stopwatch preprocessWatch;
+    dijkstra.findShortestPathALT(queries[0].first, queries[0].second, "waktu");
+    double preprocessMs = preprocessWatch.elapsedMs();
+
+    DijkstraAlgorithm restarted(graph);
+    restarted.getSnapshot();
+    Stopwatch loadWatch;
+    restarted.findShortestPathALT(queries[0].first, queries[0].second, "waktu");
+    double loadMs = loadWatch.elapsedMs();
+
+    size_t dijkstraSettled = 0, altSettled = 0;
+    bool match = true;
+    vector<double> costs;
+    Stopwatch dijkstraWatch;
+    for (const auto& query : queries) {
+        PathResult result = dijkstra.findShortestPath(query.first, query.second, "waktu");
+        costs.push_back(result.totalCost);
+        dijkstraSettled += result.settledNodes;
+    }
+    double dijkstraMs = dijkstraWatch.elapsedMs() / queries.size();
+
+    Stopwatch altWatch;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        PathResult result = dijkstra.findShortestPathALT(queries[i].first, queries[i].second, "waktu");
+        altSettled += result.settledNodes;
+        if (fabs(result.totalCost - costs[i]) > 1e-6 * max(1.0, costs[i])) match = false;
+    }
+    double altMs = altWatch.elapsedMs() / queries.size();
+
+    cout << fixed << setprecision(1);
+    cout << "Preprocessing 8 landmark (waktu): " << preprocessMs << " ms ("
+         << ThreadPool::defaultThreadCount() << " thread)" << endl;
+    cout << "Memuat ulang dari file           : " << loadMs << " ms" << endl;
+    cout << setprecision(3);
+    cout << "Dijkstra: " << dijkstraMs << " ms, " << dijkstraSettled / queries.size() << " node | ALT: "
+         << altMs << " ms, " << altSettled / queries.size() << " node | hasil sama: "
+         << (match ? "ya" : "TIDAK") << endl;
+}
+
+void benchmarkDistanceMatrix(const GraphManager& graph, size_t locationCount) {
+    cout << "\n=== Matriks jarak many-to-many ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+
+    size_t size = 200;
+    mt19937 rng(13);
+    uniform_int_distribution<size_t> pick(0, locationCount - 1);
+    vector<string> sources, targets;
+    for (size_t i = 0; i < size; ++i) {
+        sources.push_back("K" + to_string(pick(rng)));
+        targets.push_back("K" + to_string(pick(rng)));
+    }
+
+    // Cara lama: satu findShortestPath per pasangan (hanya diukur pada 10x10)
+    size_t pairSample = 10;
+    Stopwatch pairWatch;
+    for (size_t i = 0; i < pairSample; ++i) {
+        for (size_t j = 0; j < pairSample; ++j) {
+            dijkstra.findShortestPath(sources[i], targets[j], "waktu");
+        }
+    }
+    double perPairMs = pairWatch.elapsedMs() / (pairSample * pairSample);
+
+    cout << fixed << setprecision(1);
+    for (size_t threads : { static_cast<size_t>(1), ThreadPool::defaultThreadCount() }) {
+        Stopwatch matrixWatch;
+        DistanceMatrix matrix = dijkstra.computeDistanceMatrix(sources, targets, "waktu", threads);
+        double matrixMs = matrixWatch.elapsedMs();
+        cout << size << "x" << size << " dengan " << threads << " thread: " << matrixMs << " ms" << endl;
+        if (threads == ThreadPool::defaultThreadCount()) break;
+    }
+    cout << "Perkiraan per pasangan (findShortestPath): " << perPairMs * size * size << " ms" << endl;
+}
+
+void benchmarkQueryCache(GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Cache hasil query: query berulang & invalidasi ===" << endl;
+
+    // Beban kerja berulang: setiap pasangan ditanya 10 kali
+    size_t rounds = 10;
+    DijkstraAlgorithm uncached(graph);
+    uncached.getSnapshot();
+    uncached.setCacheCapacity(0);
+    Stopwatch coldWatch;
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const auto& query : queries) uncached.findShortestPath(query.first, query.second, "waktu");
+    }
+    double coldMs = coldWatch.elapsedMs() / (rounds * queries.size());
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+    Stopwatch warmWatch;
+    for (size_t r = 0; r < rounds; ++r) {
+        for (const auto& query : queries) dijkstra.findShortestPath(query.first, query.second, "waktu");
+    }
+    double warmMs = warmWatch.elapsedMs() / (rounds * queries.size());
+    CacheStats stats = dijkstra.getCacheStats();
+
+    // Perubahan graf menaikkan versi sehingga hasil lama tidak pernah dipakai lagi
+    streambuf* original = cout.rdbuf();
+    ostringstream sink;
+    cout.rdbuf(sink.rdbuf());
+    const Route& route = graph.getRoutesFrom(queries[0].first).front();
+    graph.updateRoute(queries[0].first, route.getDestination(), route.getTime(), route.getCost());
+    cout.rdbuf(original);
+
+    Stopwatch afterWatch;
+    dijkstra.findShortestPath(queries[0].first, queries[0].second, "waktu");
+    double afterMs = afterWatch.elapsedMs();
+    CacheStats afterStats = dijkstra.getCacheStats();
+
+    cout << fixed << setprecision(4);
+    cout << "Tanpa cache     : " << coldMs << " ms/query" << endl;
+    cout << "Dengan cache    : " << warmMs << " ms/query (hit rate "
+         << setprecision(1) << stats.hitRate() * 100 << "%, "
+         << stats.hits << " hit / " << stats.misses << " miss)" << endl;
+    cout << "Setelah updateRoute: " << setprecision(4) << afterMs << " ms, termasuk freeze ulang (invalidasi: "
+         << afterStats.invalidations << ", entri: " << afterStats.size << ")" << endl;
+}
+
+// Pemilihan bobot dengan perbandingan string per edge, meniru
+// Route::getWeightByMode, sebagai pembanding policy compile-time
+struct StringDispatchPolicy {
+    const CSRGraph* csr;
+    string mode;
+
+    StringDispatchPolicy(const CSRGraph& csr, const string& mode) : csr(&csr), mode(mode) {}
+
+    double operator()(uint32_t edge) const {
+        if (mode == "jarak") return csr->getDistance(edge);
+        else if (mode == "waktu") return csr->getTime(edge);
+        else if (mode == "biaya") return csr->getCost(edge);
+        return 0;
+    }
+};
+
+void benchmarkWeightPolicy(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Pemilihan bobot: string per edge vs policy compile-time ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    const CSRGraph& csr = dijkstra.getSnapshot();
+
+    PreferenceManager pref;
+    pref.setPriorities(2, 1, 3);
+
+    auto measure = [&](auto weightOf, double& checksum) {
+        Stopwatch watch;
+        for (const auto& query : queries) {
+            checksum += dijkstra.findShortestPathWith(query.first, query.second, weightOf).totalCost;
+        }
+        return watch.elapsedMs() / queries.size();
+    };
+
+    for (const string mode : { "waktu", "biaya" }) {
+        double stringSum = 0, policySum = 0;
+        double stringMs = measure(StringDispatchPolicy(csr, mode), stringSum);
+        double policyMs = mode == "waktu" ? measure(TimePolicy(csr), policySum)
+                                          : measure(CostPolicy(csr), policySum);
+        cout << fixed << setprecision(3);
+        cout << "Mode " << mode << " : string " << stringMs << " ms/query, policy " << policyMs
+             << " ms/query (" << setprecision(2) << stringMs / policyMs << "x, hasil "
+             << (fabs(stringSum - policySum) < 1e-6 ? "sama" : "BERBEDA") << ")" << endl;
+    }
+
+    // Preferensi: memanggil calculateScore lewat getter vs policy tiga kolom
+    double callSum = 0, policySum = 0;
+    double callMs = measure([&csr, &pref](uint32_t e) {
+        return pref.calculateScore(csr.getTime(e), csr.getCost(e), csr.getDistance(e));
+    }, callSum);
+    double policyMs = measure(PreferencePolicy(csr, pref), policySum);
+    cout << fixed << setprecision(3);
+    cout << "Preferensi : calculateScore " << callMs << " ms/query, policy " << policyMs
+         << " ms/query (" << setprecision(2) << callMs / policyMs << "x, hasil "
+         << (fabs(callSum - policySum) < 1e-6 ? "sama" : "BERBEDA") << ")" << endl;
+}
+
+void benchmarkPreferenceScores(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Kolom skor preferensi (SIMD) vs skor per relaksasi ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    const CSRGraph& csr = dijkstra.getSnapshot();
+    PreferenceManager pref;
+    pref.setPriorities(2, 1, 3);
+
+    const double* times = csr.getWeights(CSRGraph::WeightColumn::WAKTU).data();
+    const double* costs = csr.getWeights(CSRGraph::WeightColumn::BIAYA).data();
+    const double* distances = csr.getWeights(CSRGraph::WeightColumn::JARAK).data();
+    size_t edgeCount = csr.getEdgeCount();
+    vector<double> scalar(edgeCount), simd(edgeCount);
+
+    size_t rounds = 50;
+    Stopwatch scalarWatch;
+    for (size_t round = 0; round < rounds; ++round) {
+        computePreferenceScoresScalar(times, costs, distances, edgeCount, pref.getWeightWaktu(),
+                                      pref.getWeightBiaya(), pref.getWeightJarak(), scalar.data());
+    }
+    double scalarMs = scalarWatch.elapsedMs() / rounds;
+    Stopwatch simdWatch;
+    for (size_t round = 0; round < rounds; ++round) {
+        computePreferenceScores(times, costs, distances, edgeCount, pref.getWeightWaktu(),
+                                pref.getWeightBiaya(), pref.getWeightJarak(), simd.data());
+    }
+    double simdMs = simdWatch.elapsedMs() / rounds;
+
+#if defined(__AVX__)
+    const char* kernel = "AVX";
+#elif defined(__SSE2__)
+    const char* kernel = "SSE2";
+#else
+    const char* kernel = "skalar";
+#endif
+    cout << fixed << setprecision(3);
+    cout << "Kernel " << edgeCount << " edge: skalar " << scalarMs << " ms, " << kernel << " " << simdMs
+         << " ms (" << setprecision(2) << scalarMs / simdMs << "x, hasil " << (scalar == simd ? "sama" : "BERBEDA")
+         << ")" << endl;
+
+    // Batas node maksimum membuat query tidak di-cache, sehingga setiap
+    // ronde benar-benar menjalankan Dijkstra
+    SearchLimits uncached(numeric_limits<double>::infinity(), numeric_limits<size_t>::max() - 1);
+    double policySum = 0, columnSum = 0;
+    size_t queryRounds = 3;
+    Stopwatch policyWatch;
+    for (size_t round = 0; round < queryRounds; ++round) {
+        for (const auto& query : queries) {
+            policySum += dijkstra.findShortestPathWith(query.first, query.second, PreferencePolicy(csr, pref)).totalCost;
+        }
+    }
+    double policyMs = policyWatch.elapsedMs() / (queryRounds * queries.size());
+
+    Stopwatch columnWatch;
+    for (size_t round = 0; round < queryRounds; ++round) {
+        for (const auto& query : queries) {
+            columnSum += dijkstra.findBestRouteWithPreference(query.first, query.second, pref, uncached).totalCost;
+        }
+    }
+    double columnMs = columnWatch.elapsedMs() / (queryRounds * queries.size());
+
+    cout << setprecision(3);
+    cout << "Query preferensi: skor per relaksasi " << policyMs << " ms, kolom skor " << columnMs
+         << " ms (" << setprecision(2) << policyMs / columnMs << "x, hasil "
+         << (fabs(policySum - columnSum) < 1e-6 * max(1.0, policySum) ? "sama" : "BERBEDA") << ")" << endl;
+}
+
+void benchmarkPareto(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Pareto front (waktu, biaya, jarak) vs satu query per preferensi ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+    dijkstra.setCacheCapacity(0);
+
+    size_t queryCount = min<size_t>(10, queries.size());
+    size_t totalRoutes = 0, totalLabels = 0, maxRoutes = 0;
+    Stopwatch paretoWatch;
+    vector<ParetoFront> fronts;
+    for (size_t i = 0; i < queryCount; ++i) {
+        fronts.push_back(dijkstra.findParetoRoutes(queries[i].first, queries[i].second));
+        totalRoutes += fronts.back().routes.size();
+        totalLabels += fronts.back().labelsCreated;
+        maxRoutes = max(maxRoutes, fronts.back().routes.size());
+    }
+    double paretoMs = paretoWatch.elapsedMs() / queryCount;
+
+    // Semua 6 urutan prioritas: dijawab dari front vs Dijkstra ulang
+    vector<PreferenceManager> prefs;
+    int orders[6][3] = { {1,2,3}, {1,3,2}, {2,1,3}, {2,3,1}, {3,1,2}, {3,2,1} };
+    for (auto& order : orders) {
+        prefs.emplace_back();
+        prefs.back().setPriorities(order[0], order[1], order[2]);
+    }
+
+    bool match = true;
+    Stopwatch rerunWatch;
+    for (size_t i = 0; i < queryCount; ++i) {
+        for (const PreferenceManager& pref : prefs) {
+            double direct = dijkstra.findBestRouteWithPreference(queries[i].first, queries[i].second, pref).totalCost;
+            const ParetoRoute* best = fronts[i].best(pref);
+            if (best == nullptr || fabs(best->score(pref) - direct) > 1e-6 * max(1.0, direct)) match = false;
+        }
+    }
+    double rerunMs = rerunWatch.elapsedMs() / queryCount;
+
+    cout << fixed << setprecision(1);
+    cout << "Pareto front    : " << paretoMs << " ms/query, rata-rata " << totalRoutes / queryCount
+         << " rute (maks " << maxRoutes << "), " << totalLabels / queryCount << " label" << endl;
+    cout << "6 preferensi    : " << rerunMs << " ms/query dengan Dijkstra ulang" << endl;
+    cout << "Jawaban dari front sama: " << (match ? "ya" : "TIDAK") << endl;
+}
+
+void benchmarkKShortestPaths(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== K rute alternatif (Yen, k = 10) ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+
+    size_t queryCount = min<size_t>(10, queries.size());
+    size_t found = 0;
+    double worstMs = 0, totalSpread = 0;
+    Stopwatch watch;
+    for (size_t i = 0; i < queryCount; ++i) {
+        Stopwatch queryWatch;
+        vector<PathResult> routes = dijkstra.findKShortestPaths(queries[i].first, queries[i].second, "waktu", 10);
+        worstMs = max(worstMs, queryWatch.elapsedMs());
+        found += routes.size();
+        if (!routes.empty()) totalSpread += routes.back().totalCost - routes.front().totalCost;
+    }
+    double ms = watch.elapsedMs() / queryCount;
+
+    cout << fixed << setprecision(1);
+    cout << "Waktu rata-rata : " << ms << " ms/query (terlama " << worstMs << " ms)" << endl;
+    cout << "Rute ditemukan  : " << found << " dari " << queryCount * 10 << endl;
+    cout << "Selisih rute ke-1 dan ke-10 rata-rata: " << totalSpread / queryCount << " menit" << endl;
+}
+
+void benchmarkBudgetSearch(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Rute tercepat dengan batas biaya ===" << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    const CSRGraph& csr = dijkstra.getSnapshot();
+    dijkstra.setCacheCapacity(0);
+
+    size_t queryCount = min<size_t>(10, queries.size());
+    size_t feasible = 0, totalSettled = 0;
+    double totalSlowdown = 0, constrainedMs = 0, plainMs = 0;
+    for (size_t i = 0; i < queryCount; ++i) {
+        const string& start = queries[i].first;
+        const string& end = queries[i].second;
+
+        Stopwatch plainWatch;
+        PathResult fastest = dijkstra.findShortestPath(start, end, "waktu");
+        plainMs += plainWatch.elapsedMs();
+        PathResult cheapest = dijkstra.findShortestPath(start, end, "biaya");
+        if (fastest.path.empty()) continue;
+
+        // Anggaran di tengah antara biaya rute termurah dan biaya rute tercepat
+        double fastestCost = 0;
+        for (size_t j = 0; j + 1 < fastest.path.size(); ++j) {
+            uint32_t from = csr.getId(fastest.path[j]);
+            for (uint32_t e = csr.edgeBegin(from); e < csr.edgeEnd(from); ++e) {
+                if (csr.getName(csr.getTarget(e)) == fastest.path[j + 1]) {
+                    fastestCost += csr.getCost(e);
+                    break;
+                }
+            }
+        }
+        double budget = (cheapest.totalCost + fastestCost) / 2;
+
+        Stopwatch watch;
+        PathResult result = dijkstra.findShortestPathWithBudget(start, end, "waktu", "biaya", budget);
+        constrainedMs += watch.elapsedMs();
+        if (!result.path.empty()) {
+            ++feasible;
+            totalSettled += result.settledNodes;
+            totalSlowdown += result.totalCost / fastest.totalCost - 1;
+        }
+    }
+
+    cout << fixed << setprecision(1);
+    cout << "Tanpa batas     : " << plainMs / queryCount << " ms/query" << endl;
+    cout << "Dengan batas    : " << constrainedMs / queryCount << " ms/query, " << feasible << "/"
+         << queryCount << " memenuhi anggaran, " << (feasible ? totalSettled / feasible : 0) << " label permanen" << endl;
+    cout << "Waktu tempuh lebih lama rata-rata: " << (feasible ? 100 * totalSlowdown / feasible : 0) << "%" << endl;
+}
+
+void benchmarkRouteGeneration(size_t locationCount, unsigned seed) {
+    cout << "\n=== Auto-generate rute k tetangga terdekat (k-d tree) ===" << endl;
+
+    GraphManager generated;
+    mt19937 rng(seed);
+    double side = sqrt(static_cast<double>(locationCount)) * 10.0;
+    uniform_real_distribution<double> coordinate(0, side);
+
+    streambuf* original = cout.rdbuf();
+    ostringstream sink;
+    cout.rdbuf(sink.rdbuf());
+    for (size_t i = 0; i < locationCount; ++i) {
+        generated.addLocation("L" + to_string(i), coordinate(rng), coordinate(rng));
+    }
+    AutoRouteGenerator generator(generated);
+    Stopwatch generateWatch;
+    generator.generateRoutes(AutoRouteGenerator::TransportMode::NORMAL,
+                             AutoRouteGenerator::ConnectionMethod::NEAREST_NEIGHBORS);
+    double generateMs = generateWatch.elapsedMs();
+    cout.rdbuf(original);
+
+    // Pembanding cara lama (urutkan jarak ke semua kota) untuk sampel kota,
+    // sekaligus memastikan k tetangga terdekatnya memang terhubung
+    size_t samples = min<size_t>(100, locationCount);
+    size_t k = generator.getNeighborCount();
+    bool match = true;
+    uniform_int_distribution<size_t> pick(0, locationCount - 1);
+    Stopwatch bruteWatch;
+    for (size_t i = 0; i < samples; ++i) {
+        const string source = "L" + to_string(pick(rng));
+        const Location& from = generated.getLocations().at(source);
+        vector<pair<double, string>> distances;
+        for (const auto& dest : generated.getLocations()) {
+            if (dest.first != source) distances.push_back({ from.distanceTo(dest.second), dest.first });
+        }
+        sort(distances.begin(), distances.end());
+        for (size_t j = 0; j < min(k, distances.size()); ++j) {
+            bool connected = false;
+            for (const Route& route : generated.getRoutesFrom(source)) {
+                if (route.getDestination() == distances[j].second) connected = true;
+            }
+            if (!connected) match = false;
+        }
+    }
+    double bruteMs = bruteWatch.elapsedMs() / samples * locationCount;
+
+    cout << fixed << setprecision(0);
+    cout << locationCount << " lokasi, k = " << k << ": k-d tree " << generateMs
+         << " ms (" << ThreadPool::defaultThreadCount() << " thread, termasuk addRoutesBulk) | cara lama diperkirakan " << bruteMs
+         << " ms | tetangga sama: " << (match ? "ya" : "TIDAK") << endl;
+}
+
+void benchmarkRadiusGeneration(size_t locationCount, unsigned seed) {
+    cout << "\n=== Auto-generate rute dalam radius (spatial hash) ===" << endl;
+
+    GraphManager generated;
+    mt19937 rng(seed);
+    double side = sqrt(static_cast<double>(locationCount)) * 10.0;
+    uniform_real_distribution<double> coordinate(0, side);
+    double radius = 15.0;  // rata-rata sekitar 7 kota dalam radius
+
+    streambuf* original = cout.rdbuf();
+    ostringstream sink;
+    cout.rdbuf(sink.rdbuf());
+    for (size_t i = 0; i < locationCount; ++i) {
+        generated.addLocation("L" + to_string(i), coordinate(rng), coordinate(rng));
+    }
+    AutoRouteGenerator generator(generated);
+    Stopwatch generateWatch;
+    generator.generateRoutes(AutoRouteGenerator::TransportMode::NORMAL,
+                             AutoRouteGenerator::ConnectionMethod::RADIUS_BASED, radius);
+    double generateMs = generateWatch.elapsedMs();
+    cout.rdbuf(original);
+
+    // Pembanding cara lama (cek semua kota) untuk sampel kota: setiap kota
+    // dalam radius harus terhubung, dan tidak ada rute ke kota di luar radius
+    size_t samples = min<size_t>(100, locationCount);
+    bool match = true;
+    uniform_int_distribution<size_t> pick(0, locationCount - 1);
+    Stopwatch bruteWatch;
+    for (size_t i = 0; i < samples; ++i) {
+        const string source = "L" + to_string(pick(rng));
+        const Location& from = generated.getLocations().at(source);
+        size_t inside = 0;
+        for (const auto& dest : generated.getLocations()) {
+            if (dest.first != source && from.distanceTo(dest.second) <= radius) inside++;
+        }
+        const vector<Route>& routes = generated.getRoutesFrom(source);
+        if (routes.size() != inside) match = false;
+        for (const Route& route : routes) {
+            if (from.distanceTo(generated.getLocations().at(route.getDestination())) > radius) match = false;
+        }
+    }
+    double bruteMs = bruteWatch.elapsedMs() / samples * locationCount;
+
+    size_t routeCount = 0;
+    for (const auto& location : generated.getLocations()) {
+        routeCount += generated.getRoutesFrom(location.first).size();
+    }
+
+    cout << fixed << setprecision(0);
+    cout << locationCount << " lokasi, radius " << radius << ": spatial hash " << generateMs
+         << " ms (" << routeCount << " rute, " << ThreadPool::defaultThreadCount()
+         << " thread, termasuk addRoutesBulk) | cara lama diperkirakan "
+         << bruteMs << " ms | rute sama: " << (match ? "ya" : "TIDAK") << endl;
+}
+
+void benchmarkDelaunayGeneration(size_t locationCount, unsigned seed) {
+    cout << "\n=== Auto-generate rute triangulasi Delaunay ===" << endl;
+
+    mt19937 rng(seed);
+    double side = sqrt(static_cast<double>(locationCount)) * 10.0;
+    uniform_real_distribution<double> coordinate(0, side);
+    vector<pair<double, double>> coordinates(locationCount);
+    for (auto& point : coordinates) point = make_pair(coordinate(rng), coordinate(rng));
+
+    const pair<AutoRouteGenerator::DelaunayPruning, const char*> variants[] = {
+        make_pair(AutoRouteGenerator::DelaunayPruning::NONE, "Delaunay penuh"),
+        make_pair(AutoRouteGenerator::DelaunayPruning::GABRIEL, "Gabriel"),
+        make_pair(AutoRouteGenerator::DelaunayPruning::RELATIVE_NEIGHBORHOOD, "RNG"),
+    };
+    for (const auto& variant : variants) {
+        GraphManager generated;
+        streambuf* original = cout.rdbuf();
+        ostringstream sink;
+        cout.rdbuf(sink.rdbuf());
+        for (size_t i = 0; i < locationCount; ++i) {
+            generated.addLocation("L" + to_string(i), coordinates[i].first, coordinates[i].second);
+        }
+        AutoRouteGenerator generator(generated);
+        generator.setDelaunayPruning(variant.first);
+        Stopwatch generateWatch;
+        generator.generateRoutes(AutoRouteGenerator::TransportMode::NORMAL,
+                                 AutoRouteGenerator::ConnectionMethod::DELAUNAY);
+        double generateMs = generateWatch.elapsedMs();
+        cout.rdbuf(original);
+
+        // BFS dari satu kota: semua kota harus terjangkau
+        size_t routeCount = 0;
+        for (const auto& location : generated.getLocations()) {
+            routeCount += generated.getRoutesFrom(location.first).size();
+        }
+        set<string> visited;
+        queue<string> pending;
+        pending.push("L0");
+        visited.insert("L0");
+        while (!pending.empty()) {
+            string current = pending.front();
+            pending.pop();
+            for (const Route& route : generated.getRoutesFrom(current)) {
+                if (visited.insert(route.getDestination()).second) pending.push(route.getDestination());
+            }
+        }
+
+        cout << fixed << setprecision(0);
+        cout << locationCount << " lokasi, " << variant.second << ": " << generateMs << " ms ("
+             << routeCount << " rute, rata-rata " << setprecision(2)
+             << static_cast<double>(routeCount) / locationCount << " rute per kota) | terhubung: "
+             << (visited.size() == locationCount ? "ya" : "TIDAK") << endl;
+    }
+}
+
+void benchmarkDynamicTree(GraphManager& graph, size_t locationCount, unsigned seed) {
+    cout << "\n=== Pohon jalur terpendek inkremental: update lalu lintas ===" << endl;
+
+    DynamicShortestPathTree tree(graph, "K0", "waktu");
+    Stopwatch fullWatch;
+    size_t fullRounds = 5;
+    for (size_t r = 0; r < fullRounds; ++r) tree.recompute();
+    double fullMs = fullWatch.elapsedMs() / fullRounds;
+
+    // Aliran update waktu tempuh acak (naik dan turun) pada rute acak
+    mt19937 rng(seed);
+    uniform_int_distribution<size_t> pick(0, locationCount - 1);
+    uniform_real_distribution<double> factor(0.5, 2.0);
+    struct Change { string source; string dest; double time; double cost; };
+    vector<Change> originals;
+
+    streambuf* original = cout.rdbuf();
+    ostringstream sink;
+    cout.rdbuf(sink.rdbuf());
+
+    size_t updateCount = 1000, totalTouched = 0;
+    double repairMs = 0;
+    for (size_t i = 0; i < updateCount; ++i) {
+        string source = "K" + to_string(pick(rng));
+        const vector<Route>& routes = graph.getRoutesFrom(source);
+        if (routes.empty()) continue;
+        const Route& route = routes[rng() % routes.size()];
+        originals.push_back({ source, route.getDestination(), route.getTime(), route.getCost() });
+
+        Stopwatch watch;
+        graph.updateRoute(source, route.getDestination(), route.getTime() * factor(rng), route.getCost());
+        repairMs += watch.elapsedMs();
+        totalTouched += tree.getLastRepairTouched();
+    }
+
+    // Kembalikan bobot asli agar bagian benchmark lain tidak terpengaruh
+    for (auto it = originals.rbegin(); it != originals.rend(); ++it) {
+        graph.updateRoute(it->source, it->dest, it->time, it->cost);
+    }
+    cout.rdbuf(original);
+
+    cout << fixed << setprecision(4);
+    cout << "Dijkstra penuh  : " << fullMs << " ms/update" << endl;
+    cout << "Perbaikan inkremental: " << repairMs / originals.size() << " ms/update, rata-rata "
+         << setprecision(1) << static_cast<double>(totalTouched) / originals.size() << " node disentuh dari "
+         << locationCount << endl;
+}
+
+void benchmarkDeltaStepping(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== SSSP penuh: Dijkstra sekuensial vs delta-stepping paralel ===" << endl;
+    cout << "Core tersedia: " << ThreadPool::defaultThreadCount() << endl;
+
+    DijkstraAlgorithm dijkstra(graph);
+    dijkstra.getSnapshot();
+    size_t sourceCount = min<size_t>(5, queries.size());
+
+    Stopwatch sequentialWatch;
+    vector<vector<double>> expected;
+    for (size_t i = 0; i < sourceCount; ++i) {
+        expected.push_back(dijkstra.computeDistancesFrom(queries[i].first, "waktu"));
+    }
+    double sequentialMs = sequentialWatch.elapsedMs() / sourceCount;
+
+    cout << fixed << setprecision(1);
+    cout << "Sekuensial      : " << sequentialMs << " ms/source" << endl;
+    for (size_t threads : { 1, 2, 4, 8, 16 }) {
+        size_t mismatches = 0;
+        Stopwatch watch;
+        for (size_t i = 0; i < sourceCount; ++i) {
+            vector<double> distances = dijkstra.computeDistancesFrom(queries[i].first, "waktu",
+                                                                     SsspEngine::DELTA_STEPPING, threads);
+            for (size_t v = 0; v < distances.size(); ++v) {
+                if (fabs(distances[v] - expected[i][v]) > 1e-6) ++mismatches;
+            }
+        }
+        double ms = watch.elapsedMs() / sourceCount;
+        cout << "Delta-stepping " << setw(2) << threads << " thread: " << ms << " ms/source (speedup "
+             << setprecision(2) << sequentialMs / ms << "x, selisih: " << mismatches << ")" << setprecision(1) << endl;
+    }
+}
+
+// Jumlah query yang dijawab reader (masing-masing dengan DijkstraAlgorithm
+// sendiri) selama durationMs, opsional sambil writer mengedit graf
+size_t runConcurrentReaders(GraphManager& graph, const vector<pair<string, string>>& queries,
+                            size_t readerCount, double durationMs, bool withWriter,
+                            size_t& editCount, set<unsigned long long>& versionsSeen) {
+    atomic<bool> stop(false);
+    atomic<size_t> answered(0);
+    vector<set<unsigned long long>> versionsPerReader(readerCount);
+    vector<thread> readers;
+    for (size_t r = 0; r < readerCount; ++r) {
+        readers.emplace_back([&, r]() {
+            DijkstraAlgorithm dijkstra(graph);
+            dijkstra.setSnapshotIsolation(true);
+            dijkstra.setCacheCapacity(0);
+            size_t local = 0;
+            for (size_t i = r; !stop.load(); ++i) {
+                const auto& query = queries[i % queries.size()];
+                dijkstra.findShortestPath(query.first, query.second, "waktu");
+                versionsPerReader[r].insert(dijkstra.getSnapshot().getVersion());
+                ++local;
+            }
+            answered += local;
+        });
+    }
+
+    // Operator mengubah waktu tempuh dalam batch kecil, lalu mempublikasikan
+    // snapshot baru; bobot asli dikembalikan setelah pengukuran
+    struct Change { string source; string dest; double time; double cost; };
+    vector<Change> originals;
+    mt19937 rng(17);
+    Stopwatch watch;
+    editCount = 0;
+    while (watch.elapsedMs() < durationMs) {
+        if (withWriter) {
+            for (size_t i = 0; i < 50; ++i) {
+                const string& source = queries[rng() % queries.size()].first;
+                const vector<Route>& routes = graph.getRoutesFrom(source);
+                if (routes.empty()) continue;
+                const Route& route = routes[rng() % routes.size()];
+                originals.push_back({ source, route.getDestination(), route.getTime(), route.getCost() });
+                graph.updateRoute(source, route.getDestination(), route.getTime() * 1.5, route.getCost());
+                ++editCount;
+            }
+            graph.publishSnapshot();
+        }
+        this_thread::sleep_for(chrono::milliseconds(50));
+    }
+    stop = true;
+    for (thread& reader : readers) reader.join();
+
+    for (auto it = originals.rbegin(); it != originals.rend(); ++it) {
+        graph.updateRoute(it->source, it->dest, it->time, it->cost);
+    }
+    graph.publishSnapshot();
+    for (const auto& versions : versionsPerReader) versionsSeen.insert(versions.begin(), versions.end());
+    return answered.load();
+}
+
+void benchmarkConcurrentReads(GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Query paralel dengan snapshot isolation saat graf diedit ===" << endl;
+
+    size_t readerCount = max<size_t>(2, ThreadPool::defaultThreadCount());
+    double durationMs = 2000;
+    graph.publishSnapshot();
+
+    streambuf* original = cout.rdbuf();
+    ostringstream sink;
+    cout.rdbuf(sink.rdbuf());
+    size_t idleEdits = 0, busyEdits = 0;
+    set<unsigned long long> idleVersions, busyVersions;
+    size_t idle = runConcurrentReaders(graph, queries, readerCount, durationMs, false, idleEdits, idleVersions);
+    size_t busy = runConcurrentReaders(graph, queries, readerCount, durationMs, true, busyEdits, busyVersions);
+    cout.rdbuf(original);
+
+    cout << fixed << setprecision(1);
+    cout << readerCount << " reader, " << ThreadPool::defaultThreadCount() << " core" << endl;
+    cout << "Tanpa edit      : " << idle * 1000 / durationMs << " query/detik" << endl;
+    cout << "Sambil diedit   : " << busy * 1000 / durationMs << " query/detik (" << busyEdits
+         << " updateRoute, " << busyVersions.size() << " versi snapshot dipakai reader)" << endl;
+}
+
+void benchmarkRadixHeap(const GraphManager& graph, const vector<pair<string, string>>& queries) {
+    cout << "\n=== Bobot integer: heap 4-ary vs radix heap ===" << endl;
+
+    DijkstraAlgorithm heapDijkstra(graph);
+    heapDijkstra.getSnapshot();
+    heapDijkstra.setCacheCapacity(0);
+    heapDijkstra.setRadixHeapEnabled(false);
+    DijkstraAlgorithm radixDijkstra(graph);
+    radixDijkstra.setCacheCapacity(0);
+    radixDijkstra.setRadixHeapMinNodes(0);  // diukur di semua ukuran graf
+    radixDijkstra.findShortestPath(queries[0].first, queries[0].second, "biaya");  // kuantisasi awal
+
+    cout << fixed;
+    for (const string& mode : { string("biaya"), string("waktu") }) {
+        vector<double> expected;
+        Stopwatch heapWatch;
+        for (const auto& query : queries) {
+            expected.push_back(heapDijkstra.findShortestPath(query.first, query.second, mode).totalCost);
+        }
+        double heapMs = heapWatch.elapsedMs() / queries.size();
+
+        bool match = true;
+        Stopwatch radixWatch;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            PathResult result = radixDijkstra.findShortestPath(queries[i].first, queries[i].second, mode);
+            if (fabs(result.totalCost - expected[i]) > 1e-6 * max(1.0, expected[i])) match = false;
+        }
+        double radixMs = radixWatch.elapsedMs() / queries.size();
+
+        cout << "Mode " << mode << ": heap " << setprecision(3) << heapMs << " ms/query, radix "
+             << radixMs << " ms/query, speedup " << setprecision(2) << heapMs / radixMs
+             << "x, hasil sama: " << (match ? "ya" : "TIDAK") << endl;
+    }
+}
+
+// k terkecil (jarak, id) dengan insertion sort, seperti pada KdTree
+void keepNearest(vector<pair<double, uint32_t>>& best, size_t k, double distance, uint32_t id) {
+    pair<double, uint32_t> candidate(distance, id);
+    if (best.size() == k) {
+        if (!(candidate < best.back())) return;
+        best.pop_back();
+    }
+    best.insert(upper_bound(best.begin(), best.end(), candidate), candidate);
+}
+
+void benchmarkDistanceKernel(unsigned seed) {
+    cout << "\n=== Kernel jarak kolom koordinat (SIMD) vs Location::distanceTo ===" << endl;
+
+#if defined(__AVX2__)
+    const char* kernel = "AVX2";
+#elif defined(__AVX__)
+    const char* kernel = "AVX";
+#elif defined(__SSE2__)
+    const char* kernel = "SSE2";
+#else
+    const char* kernel = "skalar";
+#endif
+
+    const size_t sizes[] = { 10000, 25000, 50000, 100000 };
+    for (size_t locationCount : sizes) {
+        GraphManager generated;
+        mt19937 rng(seed);
+        double side = sqrt(static_cast<double>(locationCount)) * 10.0;
+        uniform_real_distribution<double> coordinate(0, side);
+        streambuf* original = cout.rdbuf();
+        ostringstream sink;
+        cout.rdbuf(sink.rdbuf());
+        for (size_t i = 0; i < locationCount; ++i) {
+            generated.addLocation("L" + to_string(i), coordinate(rng), coordinate(rng));
+        }
+        cout.rdbuf(original);
+
+        vector<const Location*> objects;
+        CoordinateStore coordinates(locationCount);
+        for (const auto& entry : generated.getLocations()) {
+            coordinates.set(static_cast<uint32_t>(objects.size()), entry.second.getX(), entry.second.getY());
+            objects.push_back(&entry.second);
+        }
+
+        // Pass brute-force dari sampel kota: jumlah kota dalam radius dan
+        // k kota terdekat, dengan jarak ke semua kota lain
+        size_t samples = 100, k = 3;
+        double radius = 15.0;
+        uniform_int_distribution<uint32_t> pick(0, static_cast<uint32_t>(locationCount - 1));
+        vector<uint32_t> sources(samples);
+        for (uint32_t& source : sources) source = pick(rng);
+
+        vector<size_t> insideObject(samples), insideKernel(samples);
+        vector<vector<pair<double, uint32_t>>> nearestObject(samples), nearestKernel(samples);
+        Stopwatch objectWatch;
+        for (size_t s = 0; s < samples; ++s) {
+            const Location& from = *objects[sources[s]];
+            for (uint32_t id = 0; id < locationCount; ++id) {
+                if (id == sources[s]) continue;
+                double distance = from.distanceTo(*objects[id]);
+                if (distance <= radius) insideObject[s]++;
+                keepNearest(nearestObject[s], k, distance, id);
+            }
+        }
+        double objectNs = objectWatch.elapsedMs() * 1e6 / (samples * locationCount);
+
+        vector<double> distances(locationCount);
+        Stopwatch kernelWatch;
+        for (size_t s = 0; s < samples; ++s) {
+            coordinates.distancesFrom(coordinates.getX(sources[s]), coordinates.getY(sources[s]),
+                                      0, locationCount, distances.data());
+            for (uint32_t id = 0; id < locationCount; ++id) {
+                if (id == sources[s]) continue;
+                if (distances[id] <= radius) insideKernel[s]++;
+                keepNearest(nearestKernel[s], k, distances[id], id);
+            }
+        }
+        double kernelNs = kernelWatch.elapsedMs() * 1e6 / (samples * locationCount);
+        bool match = insideObject == insideKernel && nearestObject == nearestKernel;
+
+        // Kernel saja (tanpa pemrosesan hasil): loop skalar vs SIMD atas kolom yang sama
+        vector<double> scalarRow(locationCount);
+        Stopwatch scalarRowWatch;
+        for (size_t s = 0; s < samples; ++s) {
+            computeDistancesScalar(coordinates.getX(sources[s]), coordinates.getY(sources[s]),
+                                   coordinates.getXs().data(), coordinates.getYs().data(),
+                                   locationCount, scalarRow.data());
+        }
+        double scalarRowNs = scalarRowWatch.elapsedMs() * 1e6 / (samples * locationCount);
+        Stopwatch simdRowWatch;
+        for (size_t s = 0; s < samples; ++s) {
+            coordinates.distancesFrom(coordinates.getX(sources[s]), coordinates.getY(sources[s]),
+                                      0, locationCount, distances.data());
+        }
+        double simdRowNs = simdRowWatch.elapsedMs() * 1e6 / (samples * locationCount);
+        match = match && scalarRow == distances;
+
+        // Pengisian jarak massal untuk pasangan acak, seperti jarak rute
+        // yang dibuat auto-generate
+        vector<uint32_t> from(locationCount * 4), to(locationCount * 4);
+        for (size_t i = 0; i < from.size(); ++i) {
+            from[i] = pick(rng);
+            to[i] = pick(rng);
+        }
+        vector<double> objectFill(from.size()), kernelFill(from.size());
+        Stopwatch objectFillWatch;
+        for (size_t i = 0; i < from.size(); ++i) objectFill[i] = objects[from[i]]->distanceTo(*objects[to[i]]);
+        double objectFillNs = objectFillWatch.elapsedMs() * 1e6 / from.size();
+        Stopwatch kernelFillWatch;
+        coordinates.distancesBetween(from.data(), to.data(), from.size(), kernelFill.data());
+        double kernelFillNs = kernelFillWatch.elapsedMs() * 1e6 / from.size();
+
+        cout << fixed << setprecision(2);
+        cout << locationCount << " lokasi | kernel: skalar " << scalarRowNs << " ns, " << kernel << " "
+             << simdRowNs << " ns per jarak | pass radius+kNN: Location " << objectNs << " ns, kolom "
+             << kernelNs << " ns (" << objectNs / kernelNs << "x) | isi " << from.size() << " jarak: "
+             << objectFillNs << " vs " << kernelFillNs << " ns (" << objectFillNs / kernelFillNs
+             << "x) | hasil sama: " << (match && objectFill == kernelFill ? "ya" : "TIDAK") << endl;
+    }
+}
+
+bool shouldRun(const string& selected, const string& section) {
+    return selected.empty() || selected == section;
+}
+
+int main(int argc, char* argv[]) {
+    size_t locationCount = 100000;
+    if (argc > 1) {
+        locationCount = static_cast<size_t>(stoul(argv[1]));
+    }
+    string section = argc > 2 ? argv[2] : "";
+    if (locationCount < 2) {
+        cerr << "❌ Jumlah lokasi minimal 2." << endl;
+        return 1;
+    }
+
+    cout << "🏗️  Membangun jaringan grid dengan " << locationCount << " lokasi..." << endl;
+    GraphManager graph;
+    Stopwatch buildWatch;
+    buildGridNetwork(graph, locationCount, 7);
+    cout << "✅ Selesai dalam " << fixed << setprecision(0) << buildWatch.elapsedMs() << " ms" << endl;
+
+    vector<pair<string, string>> queries = makeQueries(locationCount, 20, 11);
+
+    if (shouldRun(section, "heap")) benchmarkHeapDijkstra(graph, queries);
+    if (shouldRun(section, "early")) benchmarkEarlyTermination(graph, locationCount);
+    if (shouldRun(section, "bidi")) benchmarkBidirectional(graph, queries);
+    if (shouldRun(section, "astar")) benchmarkAStar(graph, queries);
+    if (shouldRun(section, "ch")) benchmarkContractionHierarchies(graph, queries);
+    if (shouldRun(section, "cch")) benchmarkCustomizableHierarchy(graph, queries);
+    if (shouldRun(section, "alt")) benchmarkLandmarks(graph, queries);
+    if (shouldRun(section, "matrix")) benchmarkDistanceMatrix(graph, locationCount);
+    if (shouldRun(section, "cache")) benchmarkQueryCache(graph, queries);
+    if (shouldRun(section, "policy")) benchmarkWeightPolicy(graph, queries);
+    if (shouldRun(section, "scores")) benchmarkPreferenceScores(graph, queries);
+    if (shouldRun(section, "pareto")) benchmarkPareto(graph, queries);
+    if (shouldRun(section, "ksp")) benchmarkKShortestPaths(graph, queries);
+    if (shouldRun(section, "budget")) benchmarkBudgetSearch(graph, queries);
+    if (shouldRun(section, "delta")) benchmarkDeltaStepping(graph, queries);
+    if (shouldRun(section, "concurrent")) benchmarkConcurrentReads(graph, queries);
+    if (shouldRun(section, "radix")) benchmarkRadixHeap(graph, queries);
+    if (shouldRun(section, "generate")) {
+        benchmarkRouteGeneration(locationCount, 17);
+        benchmarkRadiusGeneration(locationCount, 19);
+        benchmarkDelaunayGeneration(locationCount, 23);
+    }
+    if (shouldRun(section, "distance")) benchmarkDistanceKernel(29);
+    if (shouldRun(section, "dynamic")) benchmarkDynamicTree(graph, locationCount, 13);
+    return 0;
+}
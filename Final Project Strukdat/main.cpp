@@ -4,12 +4,14 @@
 #include "AutoRouteGenerator.h"
 #include "VisualizationManager.h"
 #include "PreferenceManager.h"
+#include "BatchQueryRunner.h"
 #include <iostream>
 #include <vector>
 #include <string>
 #include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <sstream>
 
 using namespace std;
 
@@ -52,6 +54,9 @@ public:
                 case 12: handleFindRouteWithPreference(); break;
                 case 13: handleTextVisualization(); break;
                 case 14: handleGraphicalVisualization(); break;
+                case 15: handleFindParetoRoutes(); break;
+                case 16: handleFindAlternativeRoutes(); break;
+                case 17: handleFindRouteWithBudget(); break;
                 case 0: cout << "👋 Terima kasih telah menggunakan sistem ini!" << endl; break;
                 default: cout << "❌ Pilihan tidak valid." << endl; break;
             }
@@ -83,6 +88,9 @@ private:
         cout << "10. 🗺️  Tampilkan Graf Lengkap" << endl;
         cout << "11. 🚀 Cari Rute Terbaik (Single Mode)" << endl;
         cout << "12. 🎯 Cari Rute dengan Preferensi Multi-kriteria" << endl;
+        cout << "15. 🧭 Cari Semua Rute Pareto (Waktu/Biaya/Jarak)" << endl;
+        cout << "16. 🔀 Cari K Rute Alternatif" << endl;
+        cout << "17. 💸 Cari Rute dengan Batas Anggaran" << endl;
         cout << "\n=== VISUALISASI ===" << endl;
         cout << "13. 📊 Visualisasi Teks (Graf & Tree)" << endl;
         cout << "14. 🎨 Visualisasi Grafis (SFML)" << endl;
@@ -241,20 +249,49 @@ private:
         }
         
         cout << "\n🔧 Pilih metode koneksi:" << endl;
-        cout << "[1] 🌐 Koneksi berdasarkan jarak terdekat (max 3 koneksi per kota)" << endl;
+        cout << "[1] 🌐 Koneksi berdasarkan jarak terdekat (max k koneksi per kota)" << endl;
         cout << "[2] 📏 Koneksi kota dalam radius tertentu" << endl;
-        cout << "Pilihan metode (1-2): ";
+        cout << "[3] 🔺 Triangulasi Delaunay (jaringan planar, selalu terhubung)" << endl;
+        cout << "Pilihan metode (1-3): ";
         
         int connectionChoice;
         cin >> connectionChoice;
         
         if (connectionChoice == 1) {
+            cout << "Jumlah koneksi per kota (k, default 3): ";
+            int neighborCount;
+            cin >> neighborCount;
+            if (neighborCount < 1) {
+                cout << "⚠️  k tidak valid, menggunakan 3" << endl;
+                neighborCount = 3;
+            }
+            autoGenerator.setNeighborCount(static_cast<size_t>(neighborCount));
             autoGenerator.generateRoutes(mode, AutoRouteGenerator::ConnectionMethod::NEAREST_NEIGHBORS);
         } else if (connectionChoice == 2) {
             cout << "Masukkan radius maksimal koneksi (km): ";
             double radius;
             cin >> radius;
             autoGenerator.generateRoutes(mode, AutoRouteGenerator::ConnectionMethod::RADIUS_BASED, radius);
+        } else if (connectionChoice == 3) {
+            cout << "Pemangkasan edge:" << endl;
+            cout << "[1] Tanpa pemangkasan (Delaunay penuh)" << endl;
+            cout << "[2] Gabriel graph" << endl;
+            cout << "[3] Relative neighbourhood graph (paling jarang)" << endl;
+            cout << "Pilihan (1-3): ";
+            int pruningChoice;
+            cin >> pruningChoice;
+            AutoRouteGenerator::DelaunayPruning pruning;
+            switch (pruningChoice) {
+                case 1: pruning = AutoRouteGenerator::DelaunayPruning::NONE; break;
+                case 2: pruning = AutoRouteGenerator::DelaunayPruning::GABRIEL; break;
+                case 3: pruning = AutoRouteGenerator::DelaunayPruning::RELATIVE_NEIGHBORHOOD; break;
+                default:
+                    cout << "⚠️  Pilihan tidak valid, tanpa pemangkasan" << endl;
+                    pruning = AutoRouteGenerator::DelaunayPruning::NONE;
+                    break;
+            }
+            autoGenerator.setDelaunayPruning(pruning);
+            autoGenerator.generateRoutes(mode, AutoRouteGenerator::ConnectionMethod::DELAUNAY);
         } else {
             cout << "❌ Pilihan tidak valid." << endl;
         }
@@ -331,6 +368,145 @@ private:
         routeSimulator.simulateJourneyWithPreference(result, preferenceManager);
     }
     
+    // Pareto front dihitung sekali, lalu setiap urutan prioritas yang dicoba
+    // pengguna langsung dijawab dari front tanpa pencarian ulang
+    void handleFindParetoRoutes() {
+        if (!hasRoutesAvailable()) return;
+        
+        graphManager.listLocations();
+        
+        vector<string> locationNames = getLocationNames();
+        
+        cout << "\n🧭 PENCARIAN SEMUA RUTE PARETO-OPTIMAL" << endl;
+        
+        string asal = selectLocation("🚀 Pilih lokasi awal:", locationNames);
+        if (asal.empty()) return;
+        
+        string tujuan = selectLocation("🏁 Pilih lokasi tujuan:", locationNames, asal);
+        if (tujuan.empty()) return;
+        
+        cout << "\n✅ Rute terpilih: " << asal << " ➜ " << tujuan << endl;
+        cout << "\n🔍 Mencari semua rute yang tidak terdominasi..." << endl;
+        
+        ParetoFront front = dijkstraAlgorithm.findParetoRoutes(asal, tujuan);
+        if (front.routes.empty()) return;
+        
+        char lagi = 'y';
+        while (lagi == 'y' || lagi == 'Y') {
+            preferenceManager.inputPrioritas();
+            routeSimulator.displayParetoFront(front, preferenceManager);
+            
+            const ParetoRoute* best = front.best(preferenceManager);
+            routeSimulator.simulateJourneyWithPreference(
+                PathResult(best->path, best->score(preferenceManager)), preferenceManager);
+            
+            cout << "\n🔁 Coba urutan prioritas lain? (y/n): ";
+            cin >> lagi;
+        }
+    }
+    
+    void handleFindAlternativeRoutes() {
+        if (!hasRoutesAvailable()) return;
+        
+        graphManager.listLocations();
+        
+        vector<string> locationNames = getLocationNames();
+        
+        cout << "\n🔀 PENCARIAN K RUTE ALTERNATIF" << endl;
+        
+        string asal = selectLocation("🚀 Pilih lokasi awal:", locationNames);
+        if (asal.empty()) return;
+        
+        string tujuan = selectLocation("🏁 Pilih lokasi tujuan:", locationNames, asal);
+        if (tujuan.empty()) return;
+        
+        cout << "\n⚙️  Pilih mode prioritas:" << endl;
+        cout << "[1] 📏 Jarak terpendek" << endl;
+        cout << "[2] ⏱️  Waktu tercepat" << endl;
+        cout << "[3] 💰 Biaya termurah" << endl;
+        cout << "Pilihan mode (1-3): ";
+        
+        int modeChoice;
+        cin >> modeChoice;
+        
+        string mode;
+        switch(modeChoice) {
+            case 1: mode = "jarak"; break;
+            case 2: mode = "waktu"; break;
+            case 3: mode = "biaya"; break;
+            default: 
+                cout << "❌ Pilihan tidak valid." << endl;
+                return;
+        }
+        
+        cout << "Jumlah alternatif yang dicari (k): ";
+        int k;
+        cin >> k;
+        if (k < 1) {
+            cout << "❌ Jumlah alternatif minimal 1." << endl;
+            return;
+        }
+        
+        vector<PathResult> routes = dijkstraAlgorithm.findKShortestPaths(asal, tujuan, mode, k);
+        routeSimulator.displayAlternatives(routes, mode);
+        
+        if (routes.size() > 1) {
+            cout << "\nPilih rute untuk disimulasikan (1-" << routes.size() << ", 0 = lewati): ";
+            int choice;
+            cin >> choice;
+            if (choice >= 1 && choice <= static_cast<int>(routes.size())) {
+                routeSimulator.simulateJourney(routes[choice - 1], mode);
+            }
+        } else if (routes.size() == 1) {
+            routeSimulator.simulateJourney(routes[0], mode);
+        }
+    }
+    
+    void handleFindRouteWithBudget() {
+        if (!hasRoutesAvailable()) return;
+        
+        graphManager.listLocations();
+        
+        vector<string> locationNames = getLocationNames();
+        
+        cout << "\n💸 PENCARIAN RUTE DENGAN BATAS ANGGARAN" << endl;
+        
+        string asal = selectLocation("🚀 Pilih lokasi awal:", locationNames);
+        if (asal.empty()) return;
+        
+        string tujuan = selectLocation("🏁 Pilih lokasi tujuan:", locationNames, asal);
+        if (tujuan.empty()) return;
+        
+        const string modes[3] = { "jarak", "waktu", "biaya" };
+        cout << "\n⚙️  Kriteria yang diminimalkan:" << endl;
+        cout << "[1] 📏 Jarak" << endl;
+        cout << "[2] ⏱️  Waktu" << endl;
+        cout << "[3] 💰 Biaya" << endl;
+        cout << "Pilihan (1-3): ";
+        int modeChoice;
+        cin >> modeChoice;
+        
+        cout << "\n🔒 Kriteria yang dibatasi (1-3, berbeda dari di atas): ";
+        int budgetChoice;
+        cin >> budgetChoice;
+        
+        if (modeChoice < 1 || modeChoice > 3 || budgetChoice < 1 || budgetChoice > 3 || modeChoice == budgetChoice) {
+            cout << "❌ Pilihan tidak valid." << endl;
+            return;
+        }
+        
+        string mode = modes[modeChoice - 1];
+        string budgetMode = modes[budgetChoice - 1];
+        cout << "Batas maksimal total " << budgetMode << ": ";
+        double budget;
+        cin >> budget;
+        
+        cout << "\n🔍 Mencari rute dengan " << mode << " terbaik dan " << budgetMode << " <= " << budget << "..." << endl;
+        
+        PathResult result = dijkstraAlgorithm.findShortestPathWithBudget(asal, tujuan, mode, budgetMode, budget);
+        routeSimulator.simulateJourney(result, mode);
+    }
+    
     void handleTextVisualization() {
         visualizationManager.displayTextVisualization();
     }
@@ -423,7 +599,101 @@ private:
     }
 };
 
-int main() {
+void printBatchUsage() {
+    cerr << "Penggunaan mode batch:" << endl;
+    cerr << "  ./main_oop --batch queries.csv --locations locations.csv (--routes routes.csv | --auto cepat|normal|ekonomis)" << endl;
+    cerr << "             [--threads N] [--format csv|jsonl] [--output hasil.csv]" << endl;
+}
+
+// Mode non-interaktif: muat graf, jalankan semua query di file secara
+// paralel, tulis hasil ke stdout atau file, ringkasan throughput ke stderr
+int runBatchMode(int argc, char* argv[]) {
+    map<string, string> options;
+    for (int i = 1; i < argc; ++i) {
+        string key = argv[i];
+        if (key.compare(0, 2, "--") != 0 || i + 1 >= argc) {
+            cerr << "❌ Argumen tidak valid: " << key << endl;
+            printBatchUsage();
+            return 1;
+        }
+        options[key.substr(2)] = argv[++i];
+    }
+    if (!options.count("batch") || !options.count("locations") ||
+        (!options.count("routes") && !options.count("auto"))) {
+        printBatchUsage();
+        return 1;
+    }
+
+    BatchQueryRunner::OutputFormat format = BatchQueryRunner::OutputFormat::CSV;
+    if (options.count("format") && !BatchQueryRunner::parseFormat(options["format"], format)) {
+        cerr << "❌ Format output tidak dikenal: " << options["format"] << endl;
+        return 1;
+    }
+    size_t threadCount = 0;
+    if (options.count("threads")) {
+        try {
+            threadCount = static_cast<size_t>(stoul(options["threads"]));
+        } catch (const exception& e) {
+            cerr << "❌ Jumlah thread tidak valid: " << options["threads"] << endl;
+            return 1;
+        }
+    }
+
+    // Pesan per lokasi/rute saat memuat graf tidak ditampilkan
+    GraphManager graph;
+    streambuf* original = cout.rdbuf();
+    ostringstream sink;
+    cout.rdbuf(sink.rdbuf());
+    bool loaded = graph.loadLocationsFromCSV(options["locations"]);
+    if (loaded && options.count("routes")) {
+        loaded = graph.loadRoutesFromCSV(options["routes"]);
+    } else if (loaded) {
+        AutoRouteGenerator generator(graph);
+        const string& modeName = options["auto"];
+        AutoRouteGenerator::TransportMode mode = AutoRouteGenerator::TransportMode::NORMAL;
+        if (modeName == "cepat") mode = AutoRouteGenerator::TransportMode::FAST;
+        else if (modeName == "ekonomis") mode = AutoRouteGenerator::TransportMode::ECONOMY;
+        generator.generateRoutes(mode, AutoRouteGenerator::ConnectionMethod::NEAREST_NEIGHBORS);
+    }
+    cout.rdbuf(original);
+    if (!loaded) {
+        cerr << "❌ Gagal memuat graf dari file." << endl;
+        return 1;
+    }
+
+    ifstream queryFile(options["batch"]);
+    if (!queryFile.is_open()) {
+        cerr << "❌ Gagal membuka file query: " << options["batch"] << endl;
+        return 1;
+    }
+
+    ofstream outputFile;
+    if (options.count("output")) {
+        outputFile.open(options["output"]);
+        if (!outputFile.is_open()) {
+            cerr << "❌ Gagal membuka file output: " << options["output"] << endl;
+            return 1;
+        }
+    }
+
+    BatchQueryRunner runner(graph, threadCount, format);
+    vector<BatchQuery> queries = runner.readQueries(queryFile);
+    cerr << "🚀 Menjalankan " << queries.size() << " query pada graf " << graph.getLocationCount() << " lokasi..." << endl;
+
+    BatchSummary summary = runner.run(queries, options.count("output") ? static_cast<ostream&>(outputFile) : cout);
+    cerr << fixed << setprecision(1);
+    cerr << "✅ " << summary.queryCount << " query selesai dalam " << summary.wallMs << " ms ("
+         << summary.throughput() << " query/detik), " << summary.foundCount << " rute ditemukan" << endl;
+    cerr << setprecision(3) << "⏱️  Latensi p50 " << summary.p50Ms << " ms, p95 " << summary.p95Ms
+         << " ms, p99 " << summary.p99Ms << " ms, maks " << summary.maxMs << " ms" << endl;
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return runBatchMode(argc, argv);
+    }
+
     TransportationSystem system;
     system.run();
     return 0;